@@ -0,0 +1,398 @@
+/**
+ * @file EulerBench.cpp
+ * @author Eden (edwardwang33773@gmail.com)
+ * @brief euler_bench => every euler circle engine, on several @b families of graph
+ * @note
+        @b Families ( @e directed and @e undirected , see @e euler_workload.hpp ) =>
+            @b cycle , @b complete ( K_n ) , @b random_multi (degrees 2 ~ 16) ,
+            @b cycle_union (random cycles of <= 8 vertices) , @b de_bruijn ( B(2, k) ) , @b torus
+
+        @b Engines =>
+            @b dense ( @e Graph , only if n <= `max_dense_nodes` ) =>
+                H (only on @b simple graphs) , H_fastest , F (only if n <= `max_F_nodes` ) , H_linear , H_parallel
+            @b sparse ( @e SparseGraph , any n ) => H_linear , H_fastest (through @e EulerBatchSolver )
+
+        @b H is @b known_invalid (see @e general_graph_tool_set.hpp ) => an invalid circle of it
+        is reported as `known` , and does @p not fail the run.
+
+        @b Metrics of each run =>
+            @b ms          => wall time of one circle (averaged, repeated up to `min_seconds`)
+            @b allocs / MB => num / bytes of @b operator_new per circle
+            @b peak_heap   => highest live heap during the runs (against the heap before them)
+            @b peak_rss    => VmHWM of the process ( @e linux , reset before each engine), else `0`
+            @b tracked_peak => peak of the @b tracked storage (matrices, views, CSR, engine buffers,
+                               the circle) in @b one query ( @e memory_tracking.hpp )
+            @b valid       => a circle from `1` , which passes @b every edge exactly once
+                              ( `yes` / `NO` , or `known` for an invalid circle of @b H )
+
+        Usage => euler_bench [--quick] [--csv]
+            exit code => `1` if any circle is invalid (but the @b known_invalid ones)
+ * @version 0.1
+ * @date 2022-10-28
+ *
+ * @copyright Copyright (c) 2022
+ *
+ */
+
+#include "../tools/batch_graph.hpp"
+#include "../tools/euler_batch_solver.hpp"
+#include "../tools/euler_workload.hpp"
+#include "../tools/memory_tracking.hpp"
+#include "../tools/thread_pool.hpp"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <new>
+#include <span>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+namespace Bench {
+
+/// @brief counters of the @b global operator_new below
+struct AllocationCounter {
+    static inline std::atomic<size_t> num_of_allocations = 0;
+    static inline std::atomic<size_t> num_of_bytes       = 0;
+    static inline std::atomic<size_t> live_bytes         = 0;
+    static inline std::atomic<size_t> peak_bytes         = 0;
+
+    static void on_allocate(size_t size) {
+        num_of_allocations.fetch_add(1, std::memory_order_relaxed);
+        num_of_bytes.fetch_add(size, std::memory_order_relaxed);
+        size_t live = live_bytes.fetch_add(size, std::memory_order_relaxed) + size;
+        size_t peak = peak_bytes.load(std::memory_order_relaxed);
+        while (live > peak && !peak_bytes.compare_exchange_weak(peak, live, std::memory_order_relaxed)) { }
+    }
+    static void on_deallocate(size_t size) {
+        live_bytes.fetch_sub(size, std::memory_order_relaxed);
+    }
+    /// @brief peak => from now on
+    static void reset_peak() {
+        peak_bytes.store(live_bytes.load(std::memory_order_relaxed), std::memory_order_relaxed);
+    }
+};
+
+} // namespace Bench
+
+// size is kept in a header ahead of each block => `operator delete` knows it
+static constexpr size_t allocation_header = alignof(std::max_align_t);
+
+void* operator new(size_t size) {
+    void* raw = std::malloc(size + allocation_header);
+    if (!raw) {
+        throw std::bad_alloc();
+    }
+    *static_cast<size_t*>(raw) = size;
+    Bench::AllocationCounter::on_allocate(size);
+    return static_cast<char*>(raw) + allocation_header;
+}
+void operator delete(void* ptr) noexcept {
+    if (!ptr) {
+        return;
+    }
+    void* raw = static_cast<char*>(ptr) - allocation_header;
+    Bench::AllocationCounter::on_deallocate(*static_cast<size_t*>(raw));
+    std::free(raw);
+}
+void operator delete(void* ptr, size_t) noexcept {
+    operator delete(ptr);
+}
+
+namespace Bench {
+
+/// @brief VmHWM in bytes, @b 0 if unknown
+size_t return_peak_rss() {
+#if defined(__linux__)
+    std::ifstream status("/proc/self/status");
+    std::string   line;
+    while (std::getline(status, line)) {
+        if (line.rfind("VmHWM:", 0) == 0) {
+            return std::strtoull(line.c_str() + 6, nullptr, 10) * 1024;
+        }
+    }
+#endif
+    return 0;
+}
+/// @brief VmHWM => the current RSS ( @e linux >= 4.0 , ignored elsewhere)
+void reset_peak_rss() {
+#if defined(__linux__)
+    std::ofstream("/proc/self/clear_refs") << "5";
+#endif
+}
+
+/// @brief one key per edge, @e undirected => ( @b from , @b to ) and ( @b to , @b from ) are the same
+std::uint64_t return_edge_key(bool directed, std::uint64_t from, std::uint64_t to) {
+    if (!directed && from > to) {
+        std::swap(from, to);
+    }
+    return (from << 32) | to;
+}
+
+/// @brief a graph of @e EulerWorkload , with its @b edge_list kept for the check
+struct Workload {
+    std::string                family;
+    bool                       directed     = true;
+    size_t                     num_of_nodes = 0;
+    size_t                     num_of_edges = 0;
+    std::vector<std::uint32_t> edges; // { from, to, multiplicity } * num_of_edges
+    Tool::EulerWorkload        graph;
+    bool                       if_multigraph = false; // any self loop or multiple edge
+
+    Workload(std::string inputFamily, Tool::EulerWorkload inputGraph)
+        : family(std::move(inputFamily))
+        , directed(inputGraph.if_directed())
+        , num_of_nodes(inputGraph.return_num_of_nodes())
+        , num_of_edges(inputGraph.return_num_of_edges())
+        , edges(inputGraph.return_edge_list())
+        , graph(std::move(inputGraph)) {
+        // a multiple edge may also be @b repeated lines of multiplicity 1
+        std::unordered_set<std::uint64_t> seen;
+        seen.reserve(edges.size() / 3);
+        for (size_t line = 0; line < edges.size() / 3; ++line) {
+            std::uint32_t from = edges[3 * line];
+            std::uint32_t to   = edges[3 * line + 1];
+            if (from == to || edges[3 * line + 2] > 1 || !seen.insert(return_edge_key(directed, from, to)).second) {
+                if_multigraph = true;
+                break;
+            }
+        }
+    }
+};
+
+/// @brief starts and ends at `1` , passes every edge of `input` exactly once
+bool if_valid_circle(std::span<const std::uint32_t> circle, const Workload& input) {
+    if (circle.size() != input.num_of_edges + 1 || circle.front() != 1 || circle.back() != 1) {
+        return false;
+    }
+    auto return_key = [&input](std::uint64_t from, std::uint64_t to) {
+        return return_edge_key(input.directed, from, to);
+    };
+    std::unordered_map<std::uint64_t, std::uint64_t> num_of_rest;
+    num_of_rest.reserve(input.num_of_edges);
+    for (size_t line = 0; line < input.num_of_edges; ++line) {
+        num_of_rest[return_key(input.edges[3 * line], input.edges[3 * line + 1])] += input.edges[3 * line + 2];
+    }
+    for (size_t index = 0; index + 1 < circle.size(); ++index) {
+        auto iter = num_of_rest.find(return_key(circle[index], circle[index + 1]));
+        if (iter == num_of_rest.end() || iter->second == 0) {
+            return false;
+        }
+        --iter->second;
+    }
+    return true;
+}
+
+struct Options {
+    bool if_quick = false;
+    bool if_csv   = false;
+
+    static constexpr size_t max_dense_nodes = 2048;
+    static constexpr size_t max_F_nodes     = 32; // a Fleury step costs O( n^3 * log(n) )
+    static constexpr double min_seconds     = 0.05; // of the repeated runs of one engine
+    static constexpr size_t max_repeats     = 100;
+};
+
+class EulerBench {
+    Options Opts;
+    bool    if_all_valid = true;
+    size_t  SolverPeak   = 0; // of @e EulerBatchSolver , whose queries are tracked on its @b worker
+
+    void print_header() {
+        if (Opts.if_csv) {
+            std::cout << "family,directed,num_of_nodes,num_of_edges,engine,repeats,ms,allocs,alloc_mb,peak_heap_mb,peak_rss_mb,tracked_peak_mb,valid\n";
+            return;
+        }
+        std::cout << std::left
+                  << std::setw(16) << "family" << std::setw(12) << "type"
+                  << std::setw(10) << "nodes" << std::setw(10) << "edges"
+                  << std::setw(14) << "engine" << std::right
+                  << std::setw(12) << "ms" << std::setw(12) << "allocs"
+                  << std::setw(12) << "alloc(MB)" << std::setw(14) << "peak_heap(MB)"
+                  << std::setw(14) << "peak_rss(MB)" << std::setw(17) << "tracked_peak(MB)"
+                  << std::setw(8) << "valid" << std::endl;
+    }
+
+    /// @param run returns the circle from `1`
+    /// @param if_known_invalid => an invalid circle is reported as `known` , not as a failure
+    template <typename Run>
+    void measure(const Workload& input, std::string_view engine, Run&& run, bool if_known_invalid = false) {
+        reset_peak_rss();
+        size_t heap_before = AllocationCounter::live_bytes.load();
+        AllocationCounter::reset_peak();
+
+        bool   if_valid     = false;
+        double tracked_peak = 0;
+        {
+            Tool::MemoryScope scope;
+            SolverPeak   = 0;
+            if_valid     = if_valid_circle(run(), input); // also a warm up
+            tracked_peak = double(std::max<size_t>(scope.return_usage().peak_bytes, SolverPeak)) / (1 << 20);
+        }
+
+        size_t allocations_before = AllocationCounter::num_of_allocations.load();
+        size_t bytes_before       = AllocationCounter::num_of_bytes.load();
+        size_t repeats            = 0;
+        auto   begin              = std::chrono::steady_clock::now();
+        double seconds            = 0;
+        while (repeats < Opts.max_repeats && (repeats == 0 || seconds < Opts.min_seconds)) {
+            auto circle = run();
+            ++repeats;
+            seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count();
+        }
+        double allocations = double(AllocationCounter::num_of_allocations.load() - allocations_before) / repeats;
+        double mb          = double(AllocationCounter::num_of_bytes.load() - bytes_before) / repeats / (1 << 20);
+        double peak_heap   = double(AllocationCounter::peak_bytes.load() - heap_before) / (1 << 20);
+        double peak_rss    = double(return_peak_rss()) / (1 << 20);
+        double ms          = 1000 * seconds / repeats;
+
+        if_all_valid           = if_all_valid && (if_valid || if_known_invalid);
+        std::string_view valid = if_valid ? "yes" : (if_known_invalid ? "known" : "NO");
+        if (Opts.if_csv) {
+            std::cout << input.family << ',' << input.directed << ',' << input.num_of_nodes << ','
+                      << input.num_of_edges << ',' << engine << ',' << repeats << ',' << ms << ','
+                      << allocations << ',' << mb << ',' << peak_heap << ',' << peak_rss << ','
+                      << tracked_peak << ',' << valid << '\n';
+            return;
+        }
+        std::cout << std::left
+                  << std::setw(16) << input.family
+                  << std::setw(12) << (input.directed ? "directed" : "undirected")
+                  << std::setw(10) << input.num_of_nodes << std::setw(10) << input.num_of_edges
+                  << std::setw(14) << engine << std::right << std::fixed << std::setprecision(3)
+                  << std::setw(12) << ms << std::setprecision(0)
+                  << std::setw(12) << allocations << std::setprecision(2)
+                  << std::setw(12) << mb << std::setw(14) << peak_heap << std::setw(14) << peak_rss
+                  << std::setw(17) << tracked_peak << std::setw(8) << valid << std::endl;
+    }
+
+    template <bool Directed>
+    void run_dense(const Workload& input) {
+        Graph<Directed> graph = input.graph.to_graph<Directed>();
+
+        auto vertices_of = [](Tool::EulerResult&& result) { return std::move(result.vertices); };
+        if (!input.if_multigraph) {
+            measure(
+                input,
+                "H",
+                [&] { return vertices_of(Graph<Directed>::return_an_euler_circle_H(graph, 1)); },
+                true
+            );
+        }
+        measure(input, "H_fastest", [&] {
+            return vertices_of(Graph<Directed>::return_an_euler_circle_H_fastest(graph, 1));
+        });
+        if (input.num_of_nodes <= Opts.max_F_nodes) {
+            measure(input, "F", [&] {
+                return vertices_of(Graph<Directed>::return_an_euler_circle_F(graph, 1));
+            });
+        }
+        measure(input, "H_linear", [&] {
+            return Graph<Directed>::return_an_euler_circle_H_linear(graph, 1);
+        });
+        measure(input, "H_parallel", [&] {
+            return Graph<Directed>::return_an_euler_circle_H_parallel(graph, 1);
+        });
+    }
+
+    template <bool Directed>
+    void run_sparse(const Workload& input) {
+        Tool::ThreadPool              pool(1);
+        Tool::EulerBatchSolver        solver(pool);
+        std::vector<Tool::BatchGraph> graphs;
+        graphs.emplace_back(Tool::SparseGraph<Directed>::build(input.num_of_nodes, input.edges));
+
+        std::vector<Tool::EulerResult> results;
+        auto                           run = [&](Tool::EulerAlgorithm algorithm) {
+            solver.solve_all(graphs, results, algorithm);
+            SolverPeak = results.front().stats.peak_bytes;
+            return std::move(results.front().vertices);
+        };
+        measure(input, "CSR_H_linear", [&] { return run(Tool::EulerAlgorithm::H_linear); });
+        measure(input, "CSR_H_fastest", [&] { return run(Tool::EulerAlgorithm::H_fastest); });
+    }
+
+    void run(const Workload& input) {
+        if (input.num_of_nodes <= Opts.max_dense_nodes) {
+            input.directed ? run_dense<true>(input) : run_dense<false>(input);
+        }
+        input.directed ? run_sparse<true>(input) : run_sparse<false>(input);
+    }
+
+public:
+    explicit EulerBench(Options inputOptions)
+        : Opts(inputOptions) { }
+
+    /// @return exit code
+    int run_all() {
+        std::vector<size_t> cycle_sizes    = { 64, 2048, size_t { 1 } << 20 };
+        std::vector<size_t> complete_sizes = { 9, 65, 513 };
+        std::vector<size_t> random_sizes   = { 16, 1024, size_t { 1 } << 18 };
+        std::vector<size_t> de_bruijn_bits = { 4, 10, 20 };
+        std::vector<size_t> torus_sides    = { 4, 32, 1024 };
+        if (Opts.if_quick) {
+            cycle_sizes    = { 16, 256 };
+            complete_sizes = { 9, 33 };
+            random_sizes   = { 16, 128 };
+            de_bruijn_bits = { 4, 8 };
+            torus_sides    = { 4, 16 };
+        }
+        // degrees 2 ~ 16, mostly small
+        const std::vector<double> degree_weights = { 0, 0, 8, 0, 4, 0, 2, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1 };
+
+        print_header();
+        for (bool directed : { true, false }) {
+            for (auto&& size : cycle_sizes) {
+                run({ "cycle", Tool::EulerWorkload::cycle(size, directed) });
+            }
+            for (auto&& size : complete_sizes) {
+                run({ "complete", Tool::EulerWorkload::complete(size, directed) });
+            }
+            for (auto&& size : random_sizes) {
+                run({ "random_multi", Tool::EulerWorkload::random_multigraph(size, degree_weights, directed, 20221028 + size) });
+            }
+            for (auto&& size : random_sizes) {
+                run({ "cycle_union", Tool::EulerWorkload::union_of_cycles(size, 8 * size, 20221028 + size, 8, directed) });
+            }
+            for (auto&& bits : de_bruijn_bits) {
+                run({ "de_bruijn", Tool::EulerWorkload::de_bruijn(2, bits, directed) });
+            }
+            for (auto&& side : torus_sides) {
+                run({ "torus", Tool::EulerWorkload::torus(side, side, directed) });
+            }
+        }
+        std::cout.flush();
+        if (!if_all_valid) {
+            std::cerr << "Some circles are invalid!" << std::endl;
+            return 1;
+        }
+        return 0;
+    }
+};
+
+} // namespace Bench
+
+int main(int argc, char** argv) {
+    Bench::Options options;
+    for (int index = 1; index < argc; ++index) {
+        std::string_view arg = argv[index];
+        if (arg == "--quick") {
+            options.if_quick = true;
+        } else if (arg == "--csv") {
+            options.if_csv = true;
+        } else {
+            std::cerr << "Usage: euler_bench [--quick] [--csv]" << std::endl;
+            return 2;
+        }
+    }
+    return Bench::EulerBench(options).run_all();
+}
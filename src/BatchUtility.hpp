@@ -0,0 +1,424 @@
+/**
+ * @file BatchUtility.hpp
+ * @author Eden (edwardwang33773@gmail.com)
+ * @brief @b Non_interactive mode => stream many graphs through a @b pipeline
+ * @note
+        @b GraphFactory::CreateGraph prompts, reads @b one matrix and may wait for a @b Y/y ,
+        so it could not be piped. With any flag, @e main runs a @b BatchPipeline instead =>
+
+            --batch                                (nothing but all defaults)
+            --algorithm=H_linear|H_fastest|F       (default => H_linear, no @b H => invalid on multigraphs)
+            --directed=judge|directed|undirected   (default => judge, @b symmetric => undirected)
+            --threads=N                            (default => 0 => all cores)
+            --format=matrix|edges|binary           (default => matrix, see @e euler_batch_solver.hpp
+                                                    and @e edge_list_reader.hpp )
+            --chunk=N                              (graphs per chunk, default => 1024)
+            --input=PATH                           (default => - => stdin)
+            --output-format=text|csv|jsonl|binary  (default => text, see @e euler_result_writer.hpp )
+            --output=PATH                          (default => - => stdout, written to its @b fd )
+            --stats                                (hot-path counters => stderr, see @e hot_path_counters.hpp )
+            --trace=PATH                           (timeline of all phases, @e Chrome_trace_event JSON,
+                                                    see @e trace_events.hpp )
+            --memory-cap=N[K|M|G]                  (bytes a graph could take, over => @b aborted ,
+                                                    default => 0 => none, see @e memory_tracking.hpp )
+
+        @b Pipeline =>
+            1. |-> a @b parser_thread reads graphs back to back, and hands over @b chunks
+                   through a @b bounded_queue (at most 2 chunks are waiting)
+            2. |-> meanwhile, the current chunk is solved on the @b thread_pool ,
+                   and written in the @b input_order , one record per graph,
+                   through a @b buffered @e EulerResultWriter (bulk writes, no flush per line)
+
+        A summary goes to @b stderr , so the output could still be piped.
+ * @version 0.1
+ * @date 2022-10-28
+ *
+ * @copyright Copyright (c) 2022
+ *
+ */
+
+#pragma once
+#include "../tools/edge_list_reader.hpp"
+#include "../tools/euler_batch_solver.hpp"
+#include "../tools/euler_result_writer.hpp"
+#include "../tools/hot_path_counters.hpp"
+#include "../tools/trace_events.hpp"
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+enum class InputFormat : unsigned short {
+    matrix = 0, // { num_of_vertex , Adjacency Matrix } , back to back
+    edges  = 1, // text edge lists, see @e edge_list_reader.hpp
+    binary = 2, // binary edge lists
+};
+
+struct BatchOptions {
+    Tool::EulerAlgorithm     algorithm      = Tool::EulerAlgorithm::H_linear;
+    Tool::DirectednessPolicy policy         = Tool::DirectednessPolicy::judge;
+    InputFormat              format         = InputFormat::matrix;
+    size_t                   num_of_threads = 0; // 0 => all cores
+    size_t                   chunk_size     = 1024;
+    std::string              input_path     = "-"; // - => stdin
+    Tool::OutputFormat       output_format  = Tool::OutputFormat::text;
+    std::string              output_path    = "-"; // - => stdout
+    bool                     if_print_stats = false;
+    std::string              trace_path     = ""; // empty => no trace
+    size_t                   memory_cap     = 0;  // bytes per graph, 0 => none
+};
+
+class BatchPipeline {
+    using chunk_type = std::vector<Tool::BatchGraph>;
+
+    static constexpr size_t max_num_of_waiting_chunks = 2;
+
+    BatchOptions Options;
+
+    std::mutex              Lock;
+    std::condition_variable Changed; // a chunk is pushed / popped, or the parser stops
+    std::deque<chunk_type>  Chunks;
+    bool                    if_parser_done = false;
+    bool                    if_cancelled   = false;
+    std::exception_ptr      ParserException;
+
+    std::optional<Tool::BatchGraph> read_graph(std::istream& input, Tool::IntegerReader& reader, size_t index) {
+        Tool::TraceSpan span("parse_graph", "input");
+        switch (Options.format) {
+        case InputFormat::edges:
+            return Tool::EdgeListReader::read_text(reader, Options.policy, index);
+        case InputFormat::binary:
+            return Tool::EdgeListReader::read_binary(input, Options.policy, index);
+        default:
+            return Tool::EulerBatchSolver::read_graph(reader, Options.policy, index);
+        }
+    }
+
+    /// @brief @b parser_thread => read chunks until the end of input (or a bad graph)
+    void parse(std::istream& input) {
+        Tool::TraceRecorder::set_thread_name("parser");
+        Tool::IntegerReader reader(input);
+        size_t              num_of_read = 0;
+        std::exception_ptr  exception;
+        while (!exception) {
+            chunk_type chunk;
+            chunk.reserve(Options.chunk_size);
+            try {
+                Tool::TraceSpan span("parse_chunk", "input");
+                while (chunk.size() < Options.chunk_size) {
+                    auto graph = read_graph(input, reader, num_of_read);
+                    if (!graph) {
+                        break;
+                    }
+                    chunk.push_back(std::move(*graph));
+                    ++num_of_read;
+                }
+            } catch (...) {
+                exception = std::current_exception(); // graphs ahead of it are still handed over
+            }
+            if (chunk.empty()) {
+                break;
+            }
+            std::unique_lock<std::mutex> lock(Lock);
+            Changed.wait(lock, [this] {
+                return Chunks.size() < max_num_of_waiting_chunks || if_cancelled;
+            });
+            if (if_cancelled) {
+                break;
+            }
+            Chunks.push_back(std::move(chunk));
+            Changed.notify_all();
+        }
+        std::lock_guard<std::mutex> guard(Lock);
+        ParserException = exception;
+        if_parser_done  = true;
+        Changed.notify_all();
+    }
+
+    /// @brief next chunk from the parser, @b std::nullopt if it has stopped
+    std::optional<chunk_type> pop_chunk() {
+        std::unique_lock<std::mutex> lock(Lock);
+        Changed.wait(lock, [this] { return !Chunks.empty() || if_parser_done; });
+        if (Chunks.empty()) {
+            return std::nullopt;
+        }
+        chunk_type chunk = std::move(Chunks.front());
+        Chunks.pop_front();
+        Changed.notify_all();
+        return chunk;
+    }
+
+    void cancel() {
+        std::lock_guard<std::mutex> guard(Lock);
+        if_cancelled = true;
+        Changed.notify_all();
+    }
+
+public:
+    explicit BatchPipeline(BatchOptions inputOptions)
+        : Options(std::move(inputOptions)) { }
+
+    /// @return the summary of all chunks, @b seconds => wall time of the whole pipeline
+    /// @exception std::logic_error from the parser, after all graphs ahead of the bad one are written
+    Tool::EulerBatchSolver::Report run(std::istream& input, Tool::EulerResultWriter& output) {
+        size_t num_of_threads = Options.num_of_threads != 0
+            ? Options.num_of_threads
+            : std::max<unsigned>(std::thread::hardware_concurrency(), 1);
+
+        Tool::ThreadPool       pool(num_of_threads);
+        Tool::EulerBatchSolver solver(pool);
+        solver.set_memory_cap(Options.memory_cap);
+
+        Tool::EulerBatchSolver::Report res;
+        res.num_of_threads = num_of_threads;
+
+        auto        begin = std::chrono::steady_clock::now();
+        std::thread parser([this, &input] { parse(input); });
+
+        std::vector<Tool::EulerResult> results;
+        try {
+            while (auto chunk = pop_chunk()) {
+                auto report = solver.solve_all(*chunk, results, Options.algorithm);
+                res.num_of_graphs += report.num_of_graphs;
+                res.num_of_euler_circles += report.num_of_euler_circles;
+                res.num_of_aborted += report.num_of_aborted;
+                res.peak_bytes = std::max(res.peak_bytes, report.peak_bytes);
+                Tool::TraceSpan span("write_chunk", "format");
+                output.write(results);
+            }
+        } catch (...) {
+            cancel();
+            parser.join();
+            throw;
+        }
+        parser.join();
+        output.flush();
+        res.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count();
+
+        if (ParserException) {
+            std::rethrow_exception(ParserException);
+        }
+        return res;
+    }
+};
+
+class BatchCommandLine {
+    static constexpr int standard_output_fd = 1;
+
+    static std::string_view return_value_of(std::string_view arg, std::string_view flag) {
+        if (arg.size() > flag.size() + 2
+            && arg.substr(0, 2) == "--"
+            && arg.substr(2, flag.size()) == flag
+            && arg[flag.size() + 2] == '=') {
+            return arg.substr(flag.size() + 3);
+        }
+        return {};
+    }
+    static size_t return_positive_num(std::string_view value, std::string_view flag) {
+        size_t res = 0;
+        for (auto&& digit : value) {
+            if (digit < '0' || digit > '9') {
+                throw std::logic_error("--" + std::string(flag) + " should be a number. ");
+            }
+            res = res * 10 + (digit - '0');
+        }
+        return res;
+    }
+    /// @brief "64M" => 64 << 20 , suffix => K / M / G
+    static size_t return_num_of_bytes(std::string_view value, std::string_view flag) {
+        size_t shift = 0;
+        switch (value.empty() ? '\0' : value.back()) {
+        case 'K':
+            shift = 10;
+            break;
+        case 'M':
+            shift = 20;
+            break;
+        case 'G':
+            shift = 30;
+            break;
+        default:
+            break;
+        }
+        if (shift != 0) {
+            value.remove_suffix(1);
+        }
+        return return_positive_num(value, flag) << shift;
+    }
+
+public:
+    BatchCommandLine() = delete;
+
+    static constexpr std::string_view usage
+        = "Usage: DiscreteMath_Exp [--help] [--batch] [--algorithm=H_linear|H_fastest|F] [--directed=judge|directed|undirected]\n"
+          "                        [--threads=N] [--format=matrix|edges|binary] [--chunk=N] [--input=PATH|-]\n"
+          "                        [--output-format=text|csv|jsonl|binary] [--output=PATH|-] [--stats] [--trace=PATH]\n"
+          "                        [--memory-cap=N[K|M|G]]\n"
+          "Without any flag => the interactive mode.\n";
+
+    /// @exception std::logic_error on an unknown flag or value
+    static BatchOptions parse(int argc, char** argv) {
+        BatchOptions res;
+        for (int index = 1; index < argc; ++index) {
+            std::string_view arg = argv[index];
+            std::string_view value;
+            if (arg == "--batch") {
+                continue; // all defaults
+            }
+            if (arg == "--stats") {
+                res.if_print_stats = true;
+                continue;
+            }
+            if (!(value = return_value_of(arg, "algorithm")).empty()) {
+                if (value == "H_linear") {
+                    res.algorithm = Tool::EulerAlgorithm::H_linear;
+                } else if (value == "H") {
+                    throw std::logic_error("Algorithm H gives invalid circles on multigraphs, use H_linear or H_fastest. ");
+                } else if (value == "H_fastest") {
+                    res.algorithm = Tool::EulerAlgorithm::H_fastest;
+                } else if (value == "F") {
+                    res.algorithm = Tool::EulerAlgorithm::F;
+                } else {
+                    throw std::logic_error("Unknown algorithm: " + std::string(value));
+                }
+            } else if (!(value = return_value_of(arg, "directed")).empty()) {
+                if (value == "judge") {
+                    res.policy = Tool::DirectednessPolicy::judge;
+                } else if (value == "directed") {
+                    res.policy = Tool::DirectednessPolicy::directed;
+                } else if (value == "undirected") {
+                    res.policy = Tool::DirectednessPolicy::undirected;
+                } else {
+                    throw std::logic_error("Unknown directedness policy: " + std::string(value));
+                }
+            } else if (!(value = return_value_of(arg, "format")).empty()) {
+                if (value == "matrix") {
+                    res.format = InputFormat::matrix;
+                } else if (value == "edges") {
+                    res.format = InputFormat::edges;
+                } else if (value == "binary") {
+                    res.format = InputFormat::binary;
+                } else {
+                    throw std::logic_error("Unknown input format: " + std::string(value));
+                }
+            } else if (!(value = return_value_of(arg, "output-format")).empty()) {
+                if (value == "text") {
+                    res.output_format = Tool::OutputFormat::text;
+                } else if (value == "csv") {
+                    res.output_format = Tool::OutputFormat::csv;
+                } else if (value == "jsonl") {
+                    res.output_format = Tool::OutputFormat::jsonl;
+                } else if (value == "binary") {
+                    res.output_format = Tool::OutputFormat::binary;
+                } else {
+                    throw std::logic_error("Unknown output format: " + std::string(value));
+                }
+            } else if (!(value = return_value_of(arg, "memory-cap")).empty()) {
+                res.memory_cap = return_num_of_bytes(value, "memory-cap");
+            } else if (!(value = return_value_of(arg, "trace")).empty()) {
+                res.trace_path = value;
+            } else if (!(value = return_value_of(arg, "output")).empty()) {
+                res.output_path = value;
+            } else if (!(value = return_value_of(arg, "threads")).empty()) {
+                res.num_of_threads = return_positive_num(value, "threads");
+            } else if (!(value = return_value_of(arg, "chunk")).empty()) {
+                res.chunk_size = std::max<size_t>(1, return_positive_num(value, "chunk"));
+            } else if (!(value = return_value_of(arg, "input")).empty()) {
+                res.input_path = value;
+            } else {
+                throw std::logic_error("Unknown flag: " + std::string(arg));
+            }
+        }
+        if (res.format != InputFormat::matrix && res.algorithm == Tool::EulerAlgorithm::F) {
+            throw std::logic_error("Fleury Algorithm needs --format=matrix. ");
+        }
+        return res;
+    }
+
+    /// @return exit code of @e main
+    static int run(int argc, char** argv) {
+        if (std::string_view(argv[1]) == "--help") {
+            std::cout << usage;
+            return 0;
+        }
+        BatchOptions options;
+        try {
+            options = parse(argc, argv);
+        } catch (const std::logic_error& error) {
+            std::cerr << error.what() << std::endl;
+            std::cerr << usage;
+            return 2;
+        }
+        try {
+            std::ifstream file;
+            if (options.input_path != "-") {
+                file.open(options.input_path, std::ios::binary);
+                if (!file) {
+                    throw std::logic_error("Cannot open " + options.input_path);
+                }
+            }
+            std::istream& input = options.input_path != "-" ? file : std::cin;
+
+            std::ofstream output_file;
+            if (options.output_path != "-") {
+                output_file.open(options.output_path, std::ios::binary);
+                if (!output_file) {
+                    throw std::logic_error("Cannot open " + options.output_path);
+                }
+            }
+            auto output = options.output_path != "-"
+                ? std::make_unique<Tool::EulerResultWriter>(output_file, options.output_format)
+                : std::make_unique<Tool::EulerResultWriter>(standard_output_fd, options.output_format);
+
+            std::ofstream trace_file;
+            if (!options.trace_path.empty()) {
+                trace_file.open(options.trace_path, std::ios::binary);
+                if (!trace_file) {
+                    throw std::logic_error("Cannot open " + options.trace_path);
+                }
+                Tool::TraceRecorder::set_thread_name("main");
+                Tool::TraceRecorder::start();
+            }
+
+            auto          counters_before = Tool::HotPathCounters::return_global_snapshot();
+            BatchPipeline pipeline(options);
+            auto          report = pipeline.run(input, *output);
+
+            if (!options.trace_path.empty()) {
+                Tool::TraceRecorder::stop();
+                Tool::TraceRecorder::write_json(trace_file);
+            }
+
+            std::cerr << report.num_of_graphs << " graphs, "
+                      << report.num_of_euler_circles << " with euler circle, "
+                      << static_cast<size_t>(report.return_graphs_per_second()) << " graphs/s on "
+                      << report.num_of_threads << " threads, peak "
+                      << report.peak_bytes << " bytes per graph" << std::endl;
+            if (report.num_of_aborted != 0) {
+                std::cerr << report.num_of_aborted << " graphs aborted (over --memory-cap)" << std::endl;
+            }
+            if (options.if_print_stats) {
+                if constexpr (Tool::HotPathCounters::if_enabled) {
+                    (Tool::HotPathCounters::return_global_snapshot() - counters_before).print(std::cerr);
+                } else {
+                    std::cerr << "Counters are compiled out, rebuild with DISCRETE_MATH_COUNTERS "
+                                 "( `xmake f --counters=y` ). " << std::endl;
+                }
+            }
+            return 0;
+        } catch (const std::exception& error) {
+            std::cerr << error.what() << std::endl;
+            return 1;
+        }
+    }
+};
@@ -26,7 +26,13 @@
 #pragma once
 #include "../tools/Matrix.hpp"
 #include "../tools/directed_graph.hpp"
+#include "../tools/euler_result_writer.hpp"
+#include "../tools/integer_reader.hpp"
+#include "../tools/trace_events.hpp"
 #include "../tools/undirected_graph.hpp"
+#include <new>
+#include <type_traits>
+#include <variant>
 
 class GraphManager;
 class GraphFactory;
@@ -38,126 +44,96 @@ class GraphManager {
         undirected = 0,
         directed   = 1,
     };
-    directed_graph*   directed   = nullptr;
-    undirected_graph* undirected = nullptr;
-    Type              graph_type = Type::undirected; // default as undirected
+    using graph_variant = std::variant<undirected_graph, directed_graph>;
+
+    graph_variant the_graph; // type is dispatched once, by `std::visit`
+
+    static graph_variant create_variant(
+        intMat::rows_type&& initMat,
+        Type                type_of_graph
+    ) {
+        using origin = intMat::rows_type;
+        if (type_of_graph == Type::undirected) {
+            return graph_variant(
+                std::in_place_type<undirected_graph>,
+                std::forward<origin>(initMat)
+            );
+        }
+        return graph_variant(
+            std::in_place_type<directed_graph>,
+            std::forward<origin>(initMat)
+        );
+    }
 
 public:
     std::string return_graph_type() {
-        std::string res;
-        if (this->graph_type == Type::directed) {
-            res = "directed_graph";
-        } else {
-            res = "undirected_graph";
-        }
-        return res;
-    }
-    ~GraphManager() {
-        if (directed) {
-            delete directed;
-        }
-        if (undirected) {
-            delete undirected;
-        }
+        return std::visit(
+            [](auto& input) -> std::string {
+                using graph_type = std::decay_t<decltype(input)>;
+                return graph_type::if_directed ? "directed_graph" : "undirected_graph";
+            },
+            the_graph
+        );
     }
 
 private:
-    GraphManager(std::vector<std::vector<int>>&& initMat, Type type_of_graph) {
-        using origin = std::vector<std::vector<int>>;
-        graph_type   = type_of_graph;
-        if (graph_type == Type::undirected) {
-            undirected = new undirected_graph(
-                std::forward<origin>(initMat)
-            );
-        } else {
-            directed = new directed_graph(
-                std::forward<origin>(initMat)
-            );
-        }
-    }
+    GraphManager(intMat::rows_type&& initMat, Type type_of_graph)
+        : the_graph(create_variant(std::move(initMat), type_of_graph)) { }
 
 public:
-    std::vector<std::string>
+    std::vector<Tool::EulerResult>
     return_euler_circle_set_H() {
-        if (directed == nullptr && undirected == nullptr) {
-            std::cout << std::endl;
-            throw std::runtime_error("Graph is not initialized. ");
-        }
-
-        std::vector<std::string> res;
-
-        if (graph_type == Type::undirected) {
-            res = undirected_graph::return_euler_circle_set_H(*undirected);
-        } else {
-            res = directed_graph::return_euler_circle_set_H(*directed);
-        }
-
-        return res;
+        return std::visit(
+            [](auto& input) {
+                using graph_type = std::decay_t<decltype(input)>;
+                return graph_type::return_euler_circle_set_H(input);
+            },
+            the_graph
+        );
     }
 
-    std::vector<std::string>
+    std::vector<Tool::EulerResult>
     return_euler_circle_set_F() {
-        if (directed == nullptr && undirected == nullptr) {
-            std::cout << std::endl;
-            throw std::runtime_error("Graph is not initialized. ");
-        }
-
-        std::vector<std::string> res;
-
-        if (graph_type == Type::undirected) {
-            res = undirected_graph::return_euler_circle_set_H(*undirected);
-        } else {
-            res = directed_graph::return_euler_circle_set_H(*directed);
-        }
-
-        return res;
+        return std::visit(
+            [](auto& input) {
+                using graph_type = std::decay_t<decltype(input)>;
+                return graph_type::return_euler_circle_set_F_parallel(input); // one start per core
+            },
+            the_graph
+        );
     }
 
-    void show_euler_circle_set_H() {
-        std::cout << "Hierholzer Algorithm => " << std::endl;
-        std::cout << std::endl;
-
-        std::vector<std::string> output;
-        output = this->return_euler_circle_set_H();
-
-        for (auto&& vec : output) {
-            for (auto&& str : vec) {
-                std::cout << str;
-            }
-            std::cout << std::endl;
-        }
-        std::cout << std::endl;
+    /// @brief all circles are written in @b bulk , flushed @b once
+    void show_euler_circle_set_H(Tool::OutputFormat format = Tool::OutputFormat::text) {
+        Tool::EulerResultWriter writer(std::cout, format);
+        writer.write_line("Hierholzer Algorithm => ").write_line("");
+        writer.write(this->return_euler_circle_set_H());
+        writer.write_line("");
+        writer.flush();
     }
 
-    void show_euler_circle_set_F() {
-        std::cout << "Fleury Algorithm (With Matrix Calculation) => " << std::endl;
-        std::cout << std::endl;
-
-        std::vector<std::string> output;
-        output = this->return_euler_circle_set_F();
-
-        for (auto&& vec : output) {
-            for (auto&& str : vec) {
-                std::cout << str;
-            }
-            std::cout << std::endl;
-        }
-        std::cout << std::endl;
+    /// @brief all circles are written in @b bulk , flushed @b once
+    void show_euler_circle_set_F(Tool::OutputFormat format = Tool::OutputFormat::text) {
+        Tool::EulerResultWriter writer(std::cout, format);
+        writer.write_line("Fleury Algorithm (With Matrix Calculation) => ").write_line("");
+        writer.write(this->return_euler_circle_set_F());
+        writer.write_line("");
+        writer.flush();
     }
 };
 
 class GraphFactory {
-    static constexpr bool if_any_less_than_zero(Tool::Matrix<int>& inputMat) {
-        size_t row = inputMat.get_sizeof_row();
-        size_t col = inputMat.get_sizeof_col();
-        for (size_t trow = 1; trow <= row; ++trow) {
-            for (size_t tcol = 1; tcol <= row; ++tcol) {
-                if (inputMat(row, col) < 0) {
-                    return true;
+    /// @brief judged @b in_place , on the rows which will become the storage of the graph
+    static bool if_symmetric_of_main_diagonal(const intMat::rows_type& initMat) {
+        size_t num_of_v = initMat.size();
+        for (size_t row = 0; row < num_of_v; ++row) {
+            for (size_t col = row + 1; col < num_of_v; ++col) {
+                if (initMat[row][col] != initMat[col][row]) {
+                    return false;
                 }
             }
         }
-        return false;
+        return true;
     }
 
 public:
@@ -169,17 +145,21 @@ public:
         GraphManager::Type graph_type = GraphManager::Type::undirected;
         /* note that => graph_type's default value should be `undirected` */
 
-        /// @brief @b data
-        Tool::Matrix<int>*            TheMat = nullptr;
-        std::vector<std::vector<int>> initMat;
-        std::vector<int>              initRow;
+        /// @brief @b data => parsed @b once , then @p moved into the graph (no copy)
+        intMat::rows_type initMat;
+
+        /// @brief @b reader => whole lines from `std::cin` , decoded by @b std::from_chars
+        Tool::IntegerReader reader(std::cin, Tool::IntegerReader::Refill::by_line);
 
         /// @brief @p input @b vertex
         while (true) {
             std::cout << std::endl;
             std::cout << "Input num of vertex (>0) => ";
 
-            std::cin >> num_of_v;
+            if (!reader.read(num_of_v)) {
+                std::cout << std::endl;
+                throw std::logic_error("Input ended before the num of vertex. ");
+            }
 
             if (num_of_v <= 0) {
                 std::cout << std::endl;
@@ -189,66 +169,87 @@ public:
             }
         }
 
-        initMat.reserve(num_of_v);
-        initRow.reserve(num_of_v);
-
-        /// @brief @p input @b matrix
+        /// @brief @p input @b matrix => a row is allocated once its first element is read
         std::cout << std::endl;
         std::cout << "Input each element in the Adjacency Matrix => " << std::endl;
-        for (size_t row = 0; row < num_of_v; ++row) {
-            for (size_t col = 0; col < num_of_v; ++col) {
-                int tmp;
-                std::cin >> tmp;
-                initRow.emplace_back(tmp);
+        {
+            Tool::TraceSpan span("read_matrix", "input");
+            for (size_t row = 0; row < num_of_v; ++row) {
+                for (size_t col = 0; col < num_of_v; ++col) {
+                    // only built on error => no allocation per element
+                    auto where_cell = [&] {
+                        return "row " + std::to_string(row + 1) + ", col " + std::to_string(col + 1);
+                    };
+                    int  element = 0;
+                    bool if_read = false;
+                    try {
+                        if_read = reader.read(element);
+                    } catch (const std::logic_error& error) {
+                        std::cout << std::endl;
+                        throw std::logic_error(where_cell() + " => " + error.what());
+                    }
+                    if (!if_read) {
+                        std::cout << std::endl;
+                        throw std::logic_error("Input ended before " + where_cell() + ". ");
+                    }
+                    if (col == 0) {
+                        try {
+                            initMat.emplace_back(num_of_v);
+                        } catch (const std::bad_alloc&) {
+                            std::cout << std::endl;
+                            throw std::logic_error(
+                                "Out of memory for " + where_cell() + " (num of vertex "
+                                + std::to_string(num_of_v) + "). "
+                            );
+                        }
+                    }
+                    initMat[row][col] = element;
+                    /// @brief @e logic_error_check_point
+                    if (element < 0) {
+                        std::cout << std::endl;
+                        throw std::logic_error("There's element <0 in the Matrix, at " + where_cell() + ". ");
+                    }
+                }
             }
-            initMat.emplace_back(initRow);
-            initRow.clear();
-        }
-
-        TheMat          = new Tool::Matrix<int>(initMat); // cannot move it!
-        auto& TheMatRef = *TheMat;
-
-        /// @brief @e logic_error_check_point
-        if (if_any_less_than_zero(TheMatRef)) {
-            std::cout << std::endl;
-            throw std::logic_error("There's element <0 in the Matrix. ");
         }
 
         bool if_need_to_confirm_type = false;
 
         /// @brief @p judge/restrict @b type
-        if (num_of_v != 1) {
-            if (!Tool::Matrix<int>::
-                    if_symmetric_of_main_diagonal(TheMatRef)) {
-                graph_type = GraphManager::Type::directed;
-                std::cout << std::endl;
-                std::cout << "Type of Graph is restricted as {directed_graph} " << std::endl;
-            } else {
-                bool if_break = false;
-                for (int index = 0; index < num_of_v; ++index) {
-                    if (initMat[index][index] % 2 != 0) {
-                        graph_type = GraphManager::Type::directed;
-                        std::cout << std::endl;
-                        std::cout << "Type of Graph is restricted as {directed_graph} " << std::endl;
-                        if_break = true;
-                        break;
+        {
+            Tool::TraceSpan span("judge_type", "validation");
+            if (num_of_v != 1) {
+                if (!if_symmetric_of_main_diagonal(initMat)) {
+                    graph_type = GraphManager::Type::directed;
+                    std::cout << std::endl;
+                    std::cout << "Type of Graph is restricted as {directed_graph} " << std::endl;
+                } else {
+                    bool if_break = false;
+                    for (int index = 0; index < num_of_v; ++index) {
+                        if (initMat[index][index] % 2 != 0) {
+                            graph_type = GraphManager::Type::directed;
+                            std::cout << std::endl;
+                            std::cout << "Type of Graph is restricted as {directed_graph} " << std::endl;
+                            if_break = true;
+                            break;
+                        }
+                    }
+                    if (!if_break) {
+                        if_need_to_confirm_type = true;
                     }
                 }
-                if (!if_break) {
-                    if_need_to_confirm_type = true;
+            } else {
+                int val = initMat[0][0];
+                if (val % 2 != 0) {
+                    graph_type = GraphManager::Type::directed;
+                    std::cout << std::endl;
+                    std::cout << "Type restricted as {directed}. " << std::endl;
+                } else if (val == 0) {
+                    graph_type = GraphManager::Type::undirected;
+                    std::cout << std::endl;
+                    std::cout << "Trivial Graph! Type judged as {undirected}. " << std::endl;
                 }
             }
-        } else {
-            int val = initMat[0][0];
-            if (val % 2 != 0) {
-                graph_type = GraphManager::Type::directed;
-                std::cout << std::endl;
-                std::cout << "Type restricted as {directed}. " << std::endl;
-            } else if (val == 0) {
-                graph_type = GraphManager::Type::undirected;
-                std::cout << std::endl;
-                std::cout << "Trivial Graph! Type judged as {undirected}. " << std::endl;
-            }
         }
 
         /// @brief @p confirm @b type
@@ -278,7 +279,7 @@ public:
             }
         }
 
-        /// @brief @p construct
+        /// @brief @p construct => the rows are moved all the way into the @b Matrix of the graph
         GraphManager res(std::move(initMat), graph_type);
 
         /// @brief @p show @b success_info_with_type
@@ -289,9 +290,6 @@ public:
             std::cout << "Successfully created a {directed} graph" << std::endl;
         }
 
-        /// @brief @p delete @b unused_mat
-        delete TheMat;
-
         std::cout << std::endl;
         return res;
     }
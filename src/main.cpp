@@ -1,18 +1,48 @@
+#include "../tests/DirectedGraphTest.hpp"
 #include "../tests/EulerTest_directed.hpp"
 #include "../tests/EulerTest_undirected.hpp"
 #include "../tests/MatrixTest.hpp"
+#include "../tests/ParallelEulerTest.hpp"
 #include "../tests/UndirectedGraphTest.hpp"
+#include "./BatchUtility.hpp"
 #include "./GraphUtility.hpp"
+#include <cstdlib>
+#include <fstream>
 
 int main(int argc, char** argv) {
     // Tests below could be recalled!
 
     // Test::MatrixTest();
     // Test::UndirectedGraphTest();
+    // Test::DirectedGraphTest();
     // Test::EulerTest_undirected();
     // Test::EulerTest_directed();
+    // Test::ParallelEulerTest();
+
+    // any flag => non-interactive mode, see @e BatchUtility.hpp
+    if (argc > 1) {
+        return BatchCommandLine::run(argc, argv);
+    }
+
+    // DISCRETE_MATH_TRACE=PATH => timeline of all phases, see @e trace_events.hpp
+    const char* trace_path = std::getenv("DISCRETE_MATH_TRACE");
+    if (trace_path) {
+        Tool::TraceRecorder::set_thread_name("main");
+        Tool::TraceRecorder::start();
+    }
 
     GraphManager the_graph = GraphFactory::CreateGraph();
     the_graph.show_euler_circle_set_H();
     the_graph.show_euler_circle_set_F();
+
+    if (trace_path) {
+        Tool::TraceRecorder::stop();
+        std::ofstream trace_file(trace_path, std::ios::binary);
+        Tool::TraceRecorder::write_json(trace_file);
+    }
+
+    // only with `xmake f --counters=y` , see @e hot_path_counters.hpp
+    if constexpr (Tool::HotPathCounters::if_enabled) {
+        Tool::HotPathCounters::return_global_snapshot().print(std::cout);
+    }
 }
@@ -0,0 +1,52 @@
+/**
+ * @file DirectedGraphTest.hpp
+ * @author Eden (edwardwang33773@gmail.com)
+ * @brief DirectedGraphTest
+ * @version 0.1
+ * @date 2022-10-20
+ *
+ * @copyright Copyright (c) 2022
+ *
+ */
+
+#pragma once
+#include "../tools/directed_graph.hpp"
+
+namespace Test {
+
+void DirectedGraphTest() {
+    std::cout << '\n';
+
+    /// @brief {1,2,3} is a ring, {4,5} is a ring, 3 -> 4 links them, 6 is alone
+    directed_graph SCC_Test = {
+        { 0, 1, 0, 0, 0, 0 },
+        { 0, 0, 1, 0, 0, 0 },
+        { 1, 0, 0, 1, 0, 0 },
+        { 0, 0, 0, 0, 1, 0 },
+        { 0, 0, 0, 1, 0, 0 },
+        { 0, 0, 0, 0, 0, 0 },
+    };
+
+    auto SCC = directed_graph::return_strongly_connected_components(SCC_Test);
+
+    std::cout << "num of components => " << SCC.num_of_components << '\n';
+    for (size_t vertex = 1; vertex <= SCC.component_of.size(); ++vertex) {
+        std::cout << "vertex " << vertex << " => component "
+                  << SCC.component_of[vertex - 1] << '\n';
+    }
+    for (size_t component = 1; component <= SCC.num_of_components; ++component) {
+        std::cout << "component " << component << " -> { ";
+        for (auto&& successor : SCC.condensation[component - 1]) {
+            std::cout << successor << " ";
+        }
+        std::cout << "}" << '\n';
+    }
+
+    if (!directed_graph::if_connective(SCC_Test)) {
+        std::cout << "SCC_Test is not strongly connective" << '\n';
+    }
+
+    std::cout << '\n';
+}
+
+} // namespace Test
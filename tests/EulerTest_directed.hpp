@@ -11,6 +11,8 @@
 
 #pragma once
 #include "../tools/directed_graph.hpp"
+#include "../tools/euler_result_writer.hpp"
+#include "../tools/euler_workload.hpp"
 
 namespace Test {
 
@@ -30,24 +32,40 @@ void EulerTest_directed() {
     /// @brief @b Hierholzer_Purely_Self_Constructed
     auto H
         = directed_graph::return_euler_circle_set_H(Nontrivial_Test);
-    for (auto&& vec : H) {
-        for (auto&& str : vec) {
-            std::cout << str;
-        }
-        std::cout << std::endl;
-    }
-    std::cout << std::endl;
+    Tool::EulerResultWriter(std::cout).write(H).write_line("");
 
     /// @brief @b Fleury_like
     auto F
         = directed_graph::return_euler_circle_set_F(Nontrivial_Test);
-    for (auto&& vec : F) {
-        for (auto&& str : vec) {
-            std::cout << str;
+    Tool::EulerResultWriter(std::cout).write(F).write_line("");
+
+    /// @brief @b Rotations_of_one_linear_Hierholzer_circle
+    auto R
+        = directed_graph::return_euler_circle_set_rotated(Nontrivial_Test);
+    for (size_t vertex = 1; vertex <= R.return_num_of_nodes(); ++vertex) {
+        for (auto&& curr : R[vertex]) {
+            std::cout << curr << " -> ";
         }
-        std::cout << std::endl;
+        std::cout << "fin. " << '\n';
     }
-    std::cout << std::endl;
+    std::cout << '\n';
+
+    /// @brief @b BEST_theorem => num of circles, without enumerating
+    std::cout << "num of euler circles => "
+              << directed_graph::return_num_of_euler_circles(Nontrivial_Test)
+              << " (mod 1e9+7 => "
+              << directed_graph::return_num_of_euler_circles_mod(Nontrivial_Test, 1000000007)
+              << ")" << '\n';
+    std::cout << '\n';
+
+    /// @brief @b All_distinct_circles_from_1 , enumerated @b lazily
+    for (auto&& circle : directed_graph::return_euler_circles(Nontrivial_Test, 1)) {
+        for (auto&& curr : circle) {
+            std::cout << curr << " -> ";
+        }
+        std::cout << "fin. " << '\n';
+    }
+    std::cout << '\n';
 
     /**
      * @brief test of @b un_trivial
@@ -59,24 +77,12 @@ void EulerTest_directed() {
     /// @brief @b Hierholzer_Purely_Self_Constructed
     auto H_trivial
         = directed_graph::return_euler_circle_set_H(Trivial_Test);
-    for (auto&& vec : H_trivial) {
-        for (auto&& str : vec) {
-            std::cout << str;
-        }
-        std::cout << std::endl;
-    }
-    std::cout << std::endl;
+    Tool::EulerResultWriter(std::cout).write(H_trivial).write_line("");
 
     /// @brief @b Fleury_like
     auto F_trivial
         = directed_graph::return_euler_circle_set_F(Trivial_Test);
-    for (auto&& vec : F_trivial) {
-        for (auto&& str : vec) {
-            std::cout << str;
-        }
-        std::cout << std::endl;
-    }
-    std::cout << std::endl;
+    Tool::EulerResultWriter(std::cout).write(F_trivial).write_line("");
 
     /**
      * @brief test of @b un_trivial
@@ -92,24 +98,45 @@ void EulerTest_directed() {
     /// @brief @b Hierholzer_Purely_Self_Constructed
     auto H_UnEuler
         = directed_graph::return_euler_circle_set_H(UnEuler_Test);
-    for (auto&& vec : H_UnEuler) {
-        for (auto&& str : vec) {
-            std::cout << str;
-        }
-        std::cout << std::endl;
-    }
-    std::cout << std::endl;
+    Tool::EulerResultWriter(std::cout).write(H_UnEuler).write_line("");
 
     /// @brief @b Fleury
     auto F_UnEuler
         = directed_graph::return_euler_circle_set_F(UnEuler_Test);
-    for (auto&& vec : F_UnEuler) {
-        for (auto&& str : vec) {
-            std::cout << str;
+    Tool::EulerResultWriter(std::cout).write(F_UnEuler).write_line("");
+
+    /**
+     * @brief test of @b generated_workload
+     * @param DeBruijn_Test => B(2, 3) , 8 vertices, 16 edges
+     */
+
+    directed_graph DeBruijn_Test = Tool::EulerWorkload::de_bruijn(2, 3).to_graph<true>();
+
+    /// @brief @b Hierholzer_Linear
+    for (auto&& curr : directed_graph::return_an_euler_circle_H_linear(DeBruijn_Test, 1)) {
+        std::cout << curr << " -> ";
+    }
+    std::cout << "fin. " << '\n';
+    std::cout << '\n';
+
+    /// @brief @b step_wise => two traversals, interleaved on one thread, 8 steps each per round
+    auto Traversal_1 = directed_graph::return_euler_traversal(DeBruijn_Test, 1);
+    auto Traversal_5 = directed_graph::return_euler_traversal(DeBruijn_Test, 5);
+    while (!Traversal_1->if_finished() || !Traversal_5->if_finished()) {
+        Traversal_1->advance(8);
+        Traversal_5->advance(8);
+        std::cout << "walked => " << Traversal_1->return_num_of_walked_edges()
+                  << " , " << Traversal_5->return_num_of_walked_edges()
+                  << " (trail " << Traversal_1->return_trail().size()
+                  << " , " << Traversal_5->return_trail().size() << ")" << '\n';
+    }
+    for (auto* traversal : { &*Traversal_1, &*Traversal_5 }) {
+        for (auto&& curr : traversal->return_circle()) {
+            std::cout << curr << " -> ";
         }
-        std::cout << std::endl;
+        std::cout << "fin. " << '\n';
     }
-    std::cout << std::endl;
+    std::cout << '\n';
 }
 
 } // namespace Test
\ No newline at end of file
@@ -11,6 +11,11 @@
 
 #pragma once
 #include "../tools/undirected_graph.hpp"
+#include "../tools/edge_list_reader.hpp"
+#include "../tools/euler_batch_solver.hpp"
+#include "../tools/euler_result_writer.hpp"
+#include "../tools/euler_workload.hpp"
+#include <sstream>
 
 namespace Test {
 
@@ -30,24 +35,32 @@ void EulerTest_undirected() {
     /// @brief @b Hierholzer_Purely_Self_Constructed
     auto H
         = undirected_graph::return_euler_circle_set_H(Nontrivial_Test);
-    for (auto&& vec : H) {
-        for (auto&& str : vec) {
-            std::cout << str;
-        }
-        std::cout << std::endl;
-    }
-    std::cout << std::endl;
+    Tool::EulerResultWriter(std::cout).write(H).write_line("");
 
     /// @brief @b Fleury
     auto F
         = undirected_graph::return_euler_circle_set_F(Nontrivial_Test);
-    for (auto&& vec : F) {
-        for (auto&& str : vec) {
-            std::cout << str;
+    Tool::EulerResultWriter(std::cout).write(F).write_line("");
+
+    /// @brief @b Rotations_of_one_linear_Hierholzer_circle
+    auto R
+        = undirected_graph::return_euler_circle_set_rotated(Nontrivial_Test);
+    for (size_t vertex = 1; vertex <= R.return_num_of_nodes(); ++vertex) {
+        for (auto&& curr : R[vertex]) {
+            std::cout << curr << " -> ";
+        }
+        std::cout << "fin. " << '\n';
+    }
+    std::cout << '\n';
+
+    /// @brief @b All_distinct_circles_from_1 , enumerated @b lazily
+    for (auto&& circle : undirected_graph::return_euler_circles(Nontrivial_Test, 1)) {
+        for (auto&& curr : circle) {
+            std::cout << curr << " -> ";
         }
-        std::cout << std::endl;
+        std::cout << "fin. " << '\n';
     }
-    std::cout << std::endl;
+    std::cout << '\n';
 
     /**
      * @brief test of @b un_trivial
@@ -59,24 +72,12 @@ void EulerTest_undirected() {
     /// @brief @b Hierholzer_Purely_Self_Constructed
     auto H_trivial
         = undirected_graph::return_euler_circle_set_H(Trivial_Test);
-    for (auto&& vec : H_trivial) {
-        for (auto&& str : vec) {
-            std::cout << str;
-        }
-        std::cout << std::endl;
-    }
-    std::cout << std::endl;
+    Tool::EulerResultWriter(std::cout).write(H_trivial).write_line("");
 
     /// @brief @b Fleury
     auto F_trivial
         = undirected_graph::return_euler_circle_set_F(Trivial_Test);
-    for (auto&& vec : F_trivial) {
-        for (auto&& str : vec) {
-            std::cout << str;
-        }
-        std::cout << std::endl;
-    }
-    std::cout << std::endl;
+    Tool::EulerResultWriter(std::cout).write(F_trivial).write_line("");
 
     /**
      * @brief test of @b un_trivial
@@ -92,24 +93,42 @@ void EulerTest_undirected() {
     /// @brief @b Hierholzer_Purely_Self_Constructed
     auto H_UnEuler
         = undirected_graph::return_euler_circle_set_H(UnEuler_Test);
-    for (auto&& vec : H_UnEuler) {
-        for (auto&& str : vec) {
-            std::cout << str;
-        }
-        std::cout << std::endl;
-    }
-    std::cout << std::endl;
+    Tool::EulerResultWriter(std::cout).write(H_UnEuler).write_line("");
 
     /// @brief @b Fleury
     auto F_UnEuler
         = undirected_graph::return_euler_circle_set_F(UnEuler_Test);
-    for (auto&& vec : F_UnEuler) {
-        for (auto&& str : vec) {
-            std::cout << str;
-        }
-        std::cout << std::endl;
-    }
-    std::cout << std::endl;
+    Tool::EulerResultWriter(std::cout).write(F_UnEuler).write_line("");
+
+    /**
+     * @brief test of @b sparse_input => two triangles sharing vertex 3 , as an @b edge_list
+     * @note `5 6 0` => 5 vertexes, 6 edges, undirected ; the last edge is listed with its multiplicity
+     */
+    std::istringstream Sparse_Input(
+        "5 6 0\n"
+        "1 2\n"
+        "2 3\n"
+        "3 1\n"
+        "3 4\n"
+        "4 5\n"
+        "5 3 1\n"
+    );
+    Tool::IntegerReader           Sparse_Reader(Sparse_Input);
+    std::vector<Tool::BatchGraph> Sparse_Test;
+    Sparse_Test.push_back(*Tool::EdgeListReader::read_text(Sparse_Reader));
+
+    Tool::ThreadPool       Sparse_Pool(1);
+    Tool::EulerBatchSolver Sparse_Solver(Sparse_Pool);
+    Tool::EulerResultWriter(std::cout).write(Sparse_Solver.solve_all(Sparse_Test)).write_line("");
+
+    /**
+     * @brief test of @b generated_workload
+     * @param Torus_Test => 3 x 3 torus, every degree is 4
+     */
+
+    std::vector<Tool::BatchGraph> Torus_Test;
+    Torus_Test.push_back(Tool::EulerWorkload::torus(3, 3).to_sparse_graph<false>());
+    Tool::EulerResultWriter(std::cout).write(Sparse_Solver.solve_all(Torus_Test)).write_line("");
 }
 
 } // namespace Test
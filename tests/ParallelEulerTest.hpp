@@ -0,0 +1,247 @@
+/**
+ * @file ParallelEulerTest.hpp
+ * @author Eden (edwardwang33773@gmail.com)
+ * @brief ParallelEulerTest => speedup of @e ParallelHierholzer , and throughput of
+ *        @e ParallelEulerCircleEnumerator and @e EulerBatchSolver , across core counts
+ * @version 0.1
+ * @date 2022-10-25
+ *
+ * @copyright Copyright (c) 2022
+ *
+ */
+
+#pragma once
+#include "../tools/directed_graph.hpp"
+#include "../tools/euler_batch_solver.hpp"
+#include "../tools/parallel_euler_circle_enumerator.hpp"
+#include "../tools/parallel_hierholzer.hpp"
+#include <chrono>
+#include <iomanip>
+#include <random>
+#include <span>
+#include <thread>
+
+namespace Test {
+
+/// @brief every edge is passed @b exactly_once , and the circle is closed at `start`
+bool if_valid_circle(
+    std::span<const std::uint32_t> circle,
+    std::uint32_t                  start,
+    size_t                         num_of_bits
+) {
+    size_t num_of_nodes = size_t { 1 } << num_of_bits;
+    if (circle.size() != 2 * num_of_nodes + 1
+        || circle.front() != start
+        || circle.back() != start) {
+        return false;
+    }
+    // de Bruijn => edge (u, v) is identified by (u, lowest bit of v)
+    std::vector<bool> if_passed(2 * num_of_nodes, false);
+    for (size_t index = 0; index + 1 < circle.size(); ++index) {
+        size_t from = circle[index] - 1;
+        size_t to   = circle[index + 1] - 1;
+        if (to != (((from << 1) | (to & 1)) & (num_of_nodes - 1))) {
+            return false;
+        }
+        size_t edge = 2 * from + (to & 1);
+        if (if_passed[edge]) {
+            return false;
+        }
+        if_passed[edge] = true;
+    }
+    return true;
+}
+
+void ParallelEulerTest() {
+    std::cout << std::endl;
+
+    /// @brief de Bruijn graph => `2^num_of_bits` vertices, u -> (u << 1 | bit)
+    constexpr size_t num_of_bits  = 20;
+    constexpr size_t num_of_nodes = size_t { 1 } << num_of_bits;
+
+    std::vector<std::uint32_t> Tails;
+    std::vector<std::uint32_t> Heads;
+    Tails.reserve(2 * num_of_nodes);
+    Heads.reserve(2 * num_of_nodes);
+    for (size_t vertex = 0; vertex < num_of_nodes; ++vertex) {
+        for (size_t bit = 0; bit <= 1; ++bit) {
+            Tails.push_back(vertex + 1);
+            Heads.push_back((((vertex << 1) | bit) & (num_of_nodes - 1)) + 1);
+        }
+    }
+
+    size_t max_num_of_threads = std::max<unsigned>(std::thread::hardware_concurrency(), 1);
+    double base_time          = 0;
+
+    std::cout << "de Bruijn B(2, " << num_of_bits << ") => "
+              << num_of_nodes << " vertices, "
+              << 2 * num_of_nodes << " edges" << std::endl;
+    std::cout << "threads    time(ms)    speedup    valid" << std::endl;
+    for (size_t num_of_threads = 1;; num_of_threads *= 2) {
+        num_of_threads = std::min(num_of_threads, max_num_of_threads);
+
+        Tool::ParallelHierholzer engine(num_of_threads);
+        engine.load_edges(
+            true,
+            num_of_nodes,
+            Tool::TrackedVector<std::uint32_t>(Tails.begin(), Tails.end()),
+            Tool::TrackedVector<std::uint32_t>(Heads.begin(), Heads.end())
+        );
+        auto  begin  = std::chrono::steady_clock::now();
+        auto& circle = engine.run(1);
+        auto  end    = std::chrono::steady_clock::now();
+
+        double time = std::chrono::duration<double, std::milli>(end - begin).count();
+        if (num_of_threads == 1) {
+            base_time = time;
+        }
+        std::cout << std::setw(7) << num_of_threads
+                  << std::setw(12) << std::fixed << std::setprecision(2) << time
+                  << std::setw(11) << base_time / time
+                  << std::setw(9) << (if_valid_circle(circle, 1, num_of_bits) ? "yes" : "NO")
+                  << std::endl;
+
+        if (num_of_threads == max_num_of_threads) {
+            break;
+        }
+    }
+    std::cout << std::endl;
+
+    /// @brief complete digraph K5 => enumerate @b all circles from 1, on the work-stealing pool
+    std::vector<std::vector<int>> Complete(5, std::vector<int>(5, 1));
+    for (size_t vertex = 0; vertex < 5; ++vertex) {
+        Complete[vertex][vertex] = 0;
+    }
+    directed_graph             Complete_Test(Complete);
+    Tool::Matrix<int>          CompleteMat(Complete);
+    Tool::DenseGraphView<true> CompleteView(CompleteMat);
+
+    // BEST counts circles cyclically, each one could start from any of the 4 out edges of 1
+    std::cout << "K5 => BEST theorem says " << directed_graph::return_num_of_euler_circles(Complete_Test)
+              << " * 4 circles from vertex 1" << std::endl;
+    std::cout << "threads    circles    tasks    circles/s/core" << std::endl;
+    for (size_t num_of_threads = 1;; num_of_threads *= 2) {
+        num_of_threads = std::min(num_of_threads, max_num_of_threads);
+
+        Tool::ThreadPool                    pool(num_of_threads);
+        Tool::ParallelEulerCircleEnumerator engine(pool);
+        engine.load(CompleteView);
+        auto report = engine.run(1, [](size_t, std::span<const std::uint32_t>) { });
+
+        std::cout << std::setw(7) << num_of_threads
+                  << std::setw(11) << report.num_of_circles
+                  << std::setw(9) << report.num_of_tasks
+                  << std::setw(18) << std::setprecision(0) << report.return_circles_per_second_per_core()
+                  << std::endl;
+
+        if (num_of_threads == max_num_of_threads) {
+            break;
+        }
+    }
+    std::cout << std::endl;
+
+    /// @brief a batch of small graphs, each one is a @b union of random cycles (half of them get an extra edge)
+    constexpr size_t num_of_graphs = 20000;
+
+    std::mt19937            engine(33773);
+    std::vector<Tool::BatchGraph> Graphs;
+    Graphs.reserve(num_of_graphs);
+    for (size_t index = 0; index < num_of_graphs; ++index) {
+        size_t                        num_of_v = 2 + engine() % 15;
+        std::vector<std::vector<int>> initMat(num_of_v, std::vector<int>(num_of_v, 0));
+        for (size_t vertex = 0; vertex < num_of_v; ++vertex) {
+            initMat[vertex][(vertex + 1) % num_of_v] += 1; // keep it strongly connective
+        }
+        for (size_t cycle = engine() % 4; cycle > 0; --cycle) {
+            size_t length = 2 + engine() % num_of_v;
+            size_t first  = engine() % num_of_v;
+            size_t prev   = first;
+            for (size_t step = 1; step < length; ++step) {
+                size_t next = engine() % num_of_v;
+                initMat[prev][next] += 1;
+                prev = next;
+            }
+            initMat[prev][first] += 1;
+        }
+        if (index % 2 == 1) {
+            initMat[engine() % num_of_v][engine() % num_of_v] += 1;
+        }
+        Graphs.emplace_back(std::in_place_type<directed_graph>, std::move(initMat));
+    }
+
+    std::vector<Tool::EulerResult> Expected;
+    std::cout << "batch of " << num_of_graphs << " graphs (2 ~ 16 vertices)" << std::endl;
+    std::cout << "threads    with circle    graphs/s    same order" << std::endl;
+    for (size_t num_of_threads = 1;; num_of_threads *= 2) {
+        num_of_threads = std::min(num_of_threads, max_num_of_threads);
+
+        Tool::ThreadPool       pool(num_of_threads);
+        Tool::EulerBatchSolver solver(pool);
+
+        std::vector<Tool::EulerResult> Results;
+        auto report = solver.solve_all(Graphs, Results);
+        if (num_of_threads == 1) {
+            Expected = Results;
+        }
+        bool if_same_order = std::equal(
+            Results.begin(), Results.end(), Expected.begin(),
+            [](const Tool::EulerResult& lhs, const Tool::EulerResult& rhs) {
+                return lhs.status == rhs.status && lhs.vertices == rhs.vertices;
+            }
+        );
+
+        std::cout << std::setw(7) << num_of_threads
+                  << std::setw(15) << report.num_of_euler_circles
+                  << std::setw(12) << std::setprecision(0) << report.return_graphs_per_second()
+                  << std::setw(14) << (if_same_order ? "yes" : "NO")
+                  << std::endl;
+
+        if (num_of_threads == max_num_of_threads) {
+            break;
+        }
+    }
+    std::cout << std::endl;
+
+    /// @brief Fleury from @b every start vertex of K9 (directed), one start per task
+    std::vector<std::vector<int>> Complete9(9, std::vector<int>(9, 1));
+    for (size_t vertex = 0; vertex < 9; ++vertex) {
+        Complete9[vertex][vertex] = 0;
+    }
+    directed_graph Complete9_Test(Complete9);
+
+    std::vector<Tool::EulerResult> Sequential = directed_graph::return_euler_circle_set_F(Complete9_Test);
+    std::cout << "K9 => Fleury from all " << Sequential.size() << " start vertices" << std::endl;
+    std::cout << "threads    time(ms)    speedup    same circles" << std::endl;
+    for (size_t num_of_threads = 1;; num_of_threads *= 2) {
+        num_of_threads = std::min(num_of_threads, max_num_of_threads);
+
+        Tool::ThreadPool pool(num_of_threads);
+        auto             begin   = std::chrono::steady_clock::now();
+        auto             Results = directed_graph::return_euler_circle_set_F(Complete9_Test, pool);
+        auto             end     = std::chrono::steady_clock::now();
+
+        double time = std::chrono::duration<double, std::milli>(end - begin).count();
+        if (num_of_threads == 1) {
+            base_time = time;
+        }
+        bool if_same = std::equal(
+            Results.begin(), Results.end(), Sequential.begin(), Sequential.end(),
+            [](const Tool::EulerResult& lhs, const Tool::EulerResult& rhs) {
+                return lhs.status == rhs.status && lhs.vertices == rhs.vertices;
+            }
+        );
+        std::cout << std::setw(7) << num_of_threads
+                  << std::setw(12) << std::setprecision(2) << time
+                  << std::setw(11) << base_time / time
+                  << std::setw(16) << (if_same ? "yes" : "NO")
+                  << std::endl;
+
+        if (num_of_threads == max_num_of_threads) {
+            break;
+        }
+    }
+
+    std::cout << std::endl;
+}
+
+} // namespace Test
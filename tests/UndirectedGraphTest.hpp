@@ -15,7 +15,7 @@
 namespace Test {
 
 void UndirectedGraphTest() {
-    std::cout << std::endl;
+    std::cout << '\n';
 
     auto trivial_graph
         = undirected_graph::create_trivial();
@@ -27,10 +27,35 @@ void UndirectedGraphTest() {
         = undirected_graph::create_zero();
 
     if (undirected_graph::is_same(zero_graph_1, trivial_graph)) {
-        std::cout << "zero_graph_with_1_point is same as trivial_graph" << std::endl;
+        std::cout << "zero_graph_with_1_point is same as trivial_graph" << '\n';
     }
 
-    std::cout << std::endl;
+    /// @brief two triangles joined by the edge 3 - 4 => derived properties are @b cached until an edit
+    undirected_graph Bowtie = {
+        { 0, 1, 1, 0, 0, 0 },
+        { 1, 0, 1, 0, 0, 0 },
+        { 1, 1, 0, 1, 0, 0 },
+        { 0, 0, 1, 0, 1, 1 },
+        { 0, 0, 0, 1, 0, 1 },
+        { 0, 0, 0, 1, 1, 0 },
+    };
+    auto show_properties = [&Bowtie]() {
+        std::cout << "version => " << undirected_graph::return_version(Bowtie)
+                  << ", has_euler_circle => " << std::boolalpha
+                  << undirected_graph::if_has_euler_circle(Bowtie) << std::noboolalpha
+                  << ", bridges => ";
+        for (auto&& [from, to] : undirected_graph::return_bridges(Bowtie)) {
+            std::cout << "(" << from << ", " << to << ") ";
+        }
+        std::cout << '\n';
+    };
+    show_properties();
+    undirected_graph::add_an_edge(Bowtie, 3, 4); // 3 - 4 is doubled => no bridge, all degrees even
+    show_properties();
+    undirected_graph::cut_an_edge(Bowtie, 1, 2); // 1 - 3 and 2 - 3 become bridges
+    show_properties();
+
+    std::cout << '\n';
 }
 
 } // namespace Test
\ No newline at end of file
@@ -11,6 +11,8 @@
 
 #pragma once
 
+#include "hot_path_counters.hpp"
+#include "memory_tracking.hpp"
 #include <cassert>
 #include <initializer_list>
 #include <iostream>
@@ -43,15 +45,22 @@ class Matrix {
     friend class undirected_graph;
     friend class info;
 
+public:
+    /// @brief storage, allocated by @b TrackingAllocator , see @e memory_tracking.hpp
+    using row_type  = TrackedVector<T>;
+    using rows_type = TrackedVector<row_type>;
+
 private:
-    std::vector<std::vector<T>> Data;
-    std::vector<T>              RowCache;
+    rows_type Data;
+    row_type  RowCache;
 
     T      TypeIdentifier;
     size_t SizeOf_Row    = 0;
     size_t SizeOf_Column = 0;
 
     void buildZeroMat(size_t& row, size_t& column) {
+        HotPathCounters::add(HotPathCounter::matrix_allocations);
+        HotPathCounters::add(HotPathCounter::matrix_bytes, row * column * sizeof(T));
         SizeOf_Row    = row;
         SizeOf_Column = column;
         Data.reserve(row);
@@ -72,8 +81,8 @@ private:
                                      std::initializer_list<T>>& initMat) {
         return initMat.size() != 0;
     }
-    constexpr bool initMatSize_check(std::vector<
-                                     std::vector<T>>& initMat) {
+    template <typename Row, typename Alloc>
+    constexpr bool initMatSize_check(std::vector<Row, Alloc>& initMat) {
         return initMat.size() != 0;
     }
     /// @brief check if each row in the initMat has the same size
@@ -91,8 +100,8 @@ private:
         }
         return ifOK;
     }
-    constexpr bool initMat_check(std::vector<
-                                 std::vector<T>>& initMat) {
+    template <typename Row, typename Alloc>
+    constexpr bool initMat_check(std::vector<Row, Alloc>& initMat) {
         bool   ifOK       = true;
         size_t tmp_Column = initMat.begin()->size();
         for (auto&& initColumn : initMat) {
@@ -214,6 +223,7 @@ public:
         if (!Matrix::multipliable(A, B)) {
             throw std::logic_error("Matrix {A} and {B} is not multipliable!");
         }
+        HotPathCounters::add(HotPathCounter::matrix_multiplications);
         using resMatType = decltype(A.TypeIdentifier);
         auto res         = Matrix<resMatType>::CreateZeroMat(
             A.SizeOf_Row,
@@ -276,6 +286,12 @@ public:
         }
         return res;
     }
+    /// @brief @b A => a copy of @b B , the storage of @b A is @p reused (no allocation if it's large enough)
+    static void A_overwritten_by_B(Matrix& A, const Matrix& B) {
+        A.Data          = B.Data;
+        A.SizeOf_Row    = B.SizeOf_Row;
+        A.SizeOf_Column = B.SizeOf_Column;
+    }
     static constexpr auto A_assigned_by_B(Matrix& A, Matrix& B)
         -> Matrix<decltype(A.TypeIdentifier)> {
         if (!Matrix::assignable(A, B)) {
@@ -403,20 +419,26 @@ public:
         // 1. assertion
         assert(initMatSize_check(initMat));
         assert(initMat_check(initMat));
-        // 2. init zero matrix
+        // 2. copy into the @b tracked storage, each row is freed right after => at most one extra row
         SizeOf_Row    = initMat.size();
         SizeOf_Column = initMat.begin()->size();
-        buildZeroMat(SizeOf_Row, SizeOf_Column);
-        // 3. write to matrix
-        unsigned short currRowNum = 0;
+        HotPathCounters::add(HotPathCounter::matrix_allocations);
+        HotPathCounters::add(HotPathCounter::matrix_bytes, SizeOf_Row * SizeOf_Column * sizeof(T));
+        Data.reserve(SizeOf_Row);
         for (auto&& initRow : initMat) {
-            unsigned short currColNum = 0;
-            for (auto&& initNum : initRow) {
-                Data[currRowNum][currColNum] = initNum;
-                ++currColNum;
-            }
-            ++currRowNum;
+            Data.emplace_back(initRow.begin(), initRow.end());
+            std::vector<T>().swap(initRow);
         }
+        initMat.clear();
+    }
+    explicit Matrix(rows_type&& initMat) {
+        // 1. assertion
+        assert(initMatSize_check(initMat));
+        assert(initMat_check(initMat));
+        // 2. take over the rows => @p no_copy
+        SizeOf_Row    = initMat.size();
+        SizeOf_Column = initMat.begin()->size();
+        Data          = std::move(initMat);
     }
     explicit Matrix(Matrix<T>* initPtr) {
         // 1. assertion
@@ -438,18 +460,11 @@ public:
         // 1. assertion
         assert(initMat.SizeOf_Row != 0);    // could dismiss
         assert(initMat.SizeOf_Column != 0); // could dismiss
-        // 2. init zero matrix
-        SizeOf_Row    = initMat.SizeOf_Row;
-        SizeOf_Column = initMat.SizeOf_Column;
-        buildZeroMat(SizeOf_Row, SizeOf_Column);
-        // 3. move to matrix
-        // for (int row = 1; row <= SizeOf_Row; ++row) {
-        //     for (int col = 1; col <= SizeOf_Column; ++col) {
-        //         Data[row - 1][col - 1] = initMat(row, col);
-        //     }
-        // }
-        this->Data     = initMat.Data;
-        this->RowCache = initMat.RowCache;
+        // 2. take over the rows => @p no_copy , `initMat` is left empty
+        SizeOf_Row     = std::exchange(initMat.SizeOf_Row, 0);
+        SizeOf_Column  = std::exchange(initMat.SizeOf_Column, 0);
+        this->Data     = std::move(initMat.Data);
+        this->RowCache = std::move(initMat.RowCache);
     }
     Matrix(Matrix<T>& initMat) {
         // 1. assertion
@@ -0,0 +1,125 @@
+/**
+ * @file adjacency_bitset.hpp
+ * @author Eden (edwardwang33773@gmail.com)
+ * @brief Bitset index of the nonzero cells in an adjacency matrix
+ * @note
+        @b One_bit_per_cell , @b 64_cells_per_word , rows are padded to whole words.
+        It only tells @e whether there's an edge, the @b multiplicity is still
+        stored in the @b DataMat , so it @p must_be_kept_in_sync with the matrix
+        (see the @b cut / @b add helpers in @e GeneralGraphToolSet ).
+ * @version 0.1
+ * @date 2022-10-20
+ *
+ * @copyright Copyright (c) 2022
+ *
+ */
+
+#pragma once
+
+#include "Matrix.hpp"
+#include "memory_tracking.hpp"
+#include <bit>
+#include <cstdint>
+#include <vector>
+
+namespace Tool {
+
+class AdjacencyBitset {
+    using word_t = std::uint64_t;
+
+    static constexpr size_t BitsOf_Word = 64;
+
+    TrackedVector<word_t> Words; // row-major, `WordsOf_Row` words per row
+    size_t                SizeOf_Row    = 0;
+    size_t                SizeOf_Column = 0;
+    size_t                WordsOf_Row   = 0;
+
+    /// @brief row, col => start from `1` (same as @b Matrix )
+    constexpr word_t* row_begin(size_t row) {
+        return Words.data() + (row - 1) * WordsOf_Row;
+    }
+    /// @brief @return index (start from `1`) of the first set bit in [word_index, WordsOf_Row), or `0`
+    constexpr size_t scan_from_word(size_t row, size_t word_index, word_t first_word) {
+        word_t* curr_row = row_begin(row);
+        word_t  curr     = first_word;
+        while (true) {
+            if (curr != 0) {
+                return word_index * BitsOf_Word + std::countr_zero(curr) + 1;
+            }
+            if (++word_index >= WordsOf_Row) {
+                return 0;
+            }
+            curr = curr_row[word_index];
+        }
+    }
+
+public:
+    AdjacencyBitset() = default;
+    explicit AdjacencyBitset(Matrix<int>& inputDataMat) {
+        rebuild(inputDataMat);
+    }
+
+    void rebuild(Matrix<int>& inputDataMat) {
+        SizeOf_Row    = inputDataMat.get_sizeof_row();
+        SizeOf_Column = inputDataMat.get_sizeof_col();
+        WordsOf_Row   = (SizeOf_Column + BitsOf_Word - 1) / BitsOf_Word;
+        Words.assign(SizeOf_Row * WordsOf_Row, 0);
+        for (size_t row = 1; row <= SizeOf_Row; ++row) {
+            for (size_t col = 1; col <= SizeOf_Column; ++col) {
+                if (inputDataMat(row, col) != 0) {
+                    set(row, col);
+                }
+            }
+        }
+    }
+
+    constexpr void set(size_t row, size_t col) {
+        size_t bit_index = col - 1;
+        row_begin(row)[bit_index / BitsOf_Word] |= word_t { 1 } << (bit_index % BitsOf_Word);
+    }
+    constexpr void reset(size_t row, size_t col) {
+        size_t bit_index = col - 1;
+        row_begin(row)[bit_index / BitsOf_Word] &= ~(word_t { 1 } << (bit_index % BitsOf_Word));
+    }
+    constexpr bool test(size_t row, size_t col) {
+        size_t bit_index = col - 1;
+        return (row_begin(row)[bit_index / BitsOf_Word] >> (bit_index % BitsOf_Word)) & 1;
+    }
+    /// @brief make the bit of (row, col) agree with the matrix again
+    void sync(Matrix<int>& inputDataMat, size_t row, size_t col) {
+        if (inputDataMat(row, col) != 0) {
+            set(row, col);
+        } else {
+            reset(row, col);
+        }
+    }
+
+    /// @brief @return first col with a nonzero cell in the row, `0` if there's none
+    constexpr size_t first_iterable(size_t row) {
+        if (WordsOf_Row == 0) {
+            return 0;
+        }
+        return scan_from_word(row, 0, row_begin(row)[0]);
+    }
+    /// @brief @return first col after `col` with a nonzero cell in the row, `0` if there's none
+    constexpr size_t next_iterable(size_t row, size_t col) {
+        if (col >= SizeOf_Column) {
+            return 0;
+        }
+        size_t bit_index  = col; // (col + 1) - 1
+        size_t word_index = bit_index / BitsOf_Word;
+        word_t masked     = row_begin(row)[word_index] & (~word_t { 0 } << (bit_index % BitsOf_Word));
+        return scan_from_word(row, word_index, masked);
+    }
+    /// @brief whole-row OR of words, replaces `sum_of_row(row) == 0`
+    constexpr bool if_row_empty(size_t row) {
+        word_t* curr_row = row_begin(row);
+        word_t  merged   = 0;
+        for (size_t word_index = 0; word_index < WordsOf_Row; ++word_index) {
+            merged |= curr_row[word_index];
+        }
+        return merged == 0;
+    }
+};
+
+} // namespace Tool
@@ -0,0 +1,43 @@
+/**
+ * @file batch_graph.hpp
+ * @author Eden (edwardwang33773@gmail.com)
+ * @brief @b BatchGraph => one graph of a batch, @b dense ( @e Graph ) or @b sparse ( @e SparseGraph )
+ * @note
+        @b DirectednessPolicy => how the type of a graph is decided, if its input doesn't say =>
+            @b judge      => the same rule as @e GraphFactory , but @b symmetric => undirected (no confirm)
+            @b directed   => always directed
+            @b undirected => always undirected (an asymmetric matrix is an error)
+ * @version 0.1
+ * @date 2022-10-28
+ *
+ * @copyright Copyright (c) 2022
+ *
+ */
+
+#pragma once
+
+#include "directed_graph.hpp"
+#include "sparse_graph.hpp"
+#include "undirected_graph.hpp"
+#include <variant>
+
+namespace Tool {
+
+using BatchGraph = std::variant<
+    undirected_graph,
+    directed_graph,
+    SparseGraph<false>,
+    SparseGraph<true>>;
+
+enum class DirectednessPolicy : unsigned short {
+    judge      = 0,
+    directed   = 1,
+    undirected = 2,
+};
+
+template <typename G>
+inline constexpr bool if_sparse_graph = false;
+template <bool Directed>
+inline constexpr bool if_sparse_graph<SparseGraph<Directed>> = true;
+
+} // namespace Tool
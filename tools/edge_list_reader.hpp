@@ -0,0 +1,187 @@
+/**
+ * @file edge_list_reader.hpp
+ * @author Eden (edwardwang33773@gmail.com)
+ * @brief Read @b sparse graphs from an @b edge_list , into a @e SparseGraph , in O( V + E )
+ * @note
+        @b text record =>
+            n m [directed]          => num of vertex, num of edge lines, `1` / `0` (optional)
+            u v [multiplicity]      => @b m lines, multiplicity is `1` if omitted
+
+        @b binary record => @b uint32 , @p native_byte_order =>
+            n, m, directed ( `0` / `1` , `2` => omitted )
+            { u, v, multiplicity } * m
+
+        @b directed omitted => decided by the @e DirectednessPolicy =>
+            @b judge      => the list is read as a @b directed adjacency ( @b exactly like a matrix ),
+                             a @b symmetric one becomes @e undirected (found in one pass over the CSR)
+            @b undirected => each line is @b one undirected edge
+            @b directed   => each line is @b one arc
+
+        Edges are collected as flat { u, v, multiplicity } triples, which are handed to
+        @b SparseGraph::build => no @b dense_matrix is ever made.
+ * @version 0.1
+ * @date 2022-10-28
+ *
+ * @copyright Copyright (c) 2022
+ *
+ */
+
+#pragma once
+
+#include "batch_graph.hpp"
+#include "integer_reader.hpp"
+#include <algorithm>
+#include <cstdint>
+#include <istream>
+#include <limits>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace Tool {
+
+class EdgeListReader {
+    static constexpr std::uint32_t directed_omitted = 2;
+    static constexpr size_t        max_reserved     = size_t { 1 } << 20; // edges, against a wrong header
+
+    static BatchGraph make_graph(
+        size_t                       num_of_nodes,
+        std::vector<std::uint32_t>&& edges,
+        std::uint32_t                directed,
+        DirectednessPolicy           policy
+    ) {
+        if (directed == directed_omitted) {
+            if (policy == DirectednessPolicy::directed) {
+                directed = 1;
+            } else if (policy == DirectednessPolicy::undirected) {
+                directed = 0;
+            } else {
+                auto adjacency = SparseGraph<true>::build(num_of_nodes, edges);
+                if (adjacency.if_symmetric()) {
+                    return SparseGraph<false>::from_symmetric(std::move(adjacency));
+                }
+                return adjacency;
+            }
+        }
+        if (directed == 1) {
+            return SparseGraph<true>::build(num_of_nodes, edges);
+        }
+        return SparseGraph<false>::build(num_of_nodes, edges);
+    }
+
+public:
+    EdgeListReader() = delete;
+
+    /**
+     * @brief read @b one text record, @b std::nullopt at the end of `input`
+     * @param index of the graph (from `0`), only used in the error message
+     * @exception std::logic_error with the @b index of the bad graph, and the @b line of the bad edge
+     */
+    static std::optional<BatchGraph> read_text(
+        IntegerReader&     input,
+        DirectednessPolicy policy = DirectednessPolicy::judge,
+        size_t             index  = 0
+    ) {
+        std::string where = "Graph #" + std::to_string(index) + ": ";
+        try {
+            std::uint32_t num_of_nodes = 0;
+            size_t        num_of_lines = 0;
+            std::uint32_t directed     = directed_omitted;
+            if (!input.read(num_of_nodes)) {
+                return std::nullopt;
+            }
+            if (num_of_nodes == 0) {
+                throw std::logic_error("num of vertex should >0. ");
+            }
+            if (!input.read_in_line(num_of_lines)) {
+                throw std::logic_error(
+                    "line " + std::to_string(input.return_line()) + ": num of edges is missing. "
+                );
+            }
+            if (input.read_in_line(directed) && directed > 1) {
+                throw std::logic_error(
+                    "line " + std::to_string(input.return_line()) + ": directed should be `0` or `1`. "
+                );
+            }
+
+            std::vector<std::uint32_t> edges;
+            edges.reserve(3 * std::min(num_of_lines, max_reserved));
+            for (size_t line = 0; line < num_of_lines; ++line) {
+                std::uint32_t from  = 0;
+                std::uint32_t to    = 0;
+                std::uint32_t count = 1;
+                if (!input.read(from)) {
+                    throw std::logic_error("the edge list ends before edge #" + std::to_string(line) + ". ");
+                }
+                if (!input.read_in_line(to)) {
+                    throw std::logic_error(
+                        "line " + std::to_string(input.return_line()) + ": an edge needs two vertexes. "
+                    );
+                }
+                input.read_in_line(count);
+                if (from == 0 || from > num_of_nodes || to == 0 || to > num_of_nodes) {
+                    throw std::logic_error(
+                        "line " + std::to_string(input.return_line())
+                        + ": vertex should be in [1, " + std::to_string(num_of_nodes) + "]. "
+                    );
+                }
+                edges.push_back(from), edges.push_back(to), edges.push_back(count);
+            }
+            return make_graph(num_of_nodes, std::move(edges), directed, policy);
+        } catch (const std::logic_error& error) {
+            throw std::logic_error(where + error.what());
+        }
+    }
+
+    /**
+     * @brief read @b one binary record, @b std::nullopt at the end of `input`
+     * @exception std::logic_error with the @b index of the bad graph
+     */
+    static std::optional<BatchGraph> read_binary(
+        std::istream&      input,
+        DirectednessPolicy policy = DirectednessPolicy::judge,
+        size_t             index  = 0
+    ) {
+        std::string where = "Graph #" + std::to_string(index) + ": ";
+
+        std::uint32_t header[3] = {};
+        input.read(reinterpret_cast<char*>(header), sizeof(header));
+        if (input.gcount() == 0) {
+            return std::nullopt;
+        }
+        if (input.gcount() != sizeof(header)) {
+            throw std::logic_error(where + "the header is truncated. ");
+        }
+        auto [num_of_nodes, num_of_lines, directed] = header;
+        if (num_of_nodes == 0) {
+            throw std::logic_error(where + "num of vertex should >0. ");
+        }
+        if (directed > directed_omitted) {
+            throw std::logic_error(where + "directed should be `0` , `1` or `2`. ");
+        }
+
+        // grow block by block => a wrong header won't allocate all at once
+        std::vector<std::uint32_t> edges;
+        size_t                     num_of_values = 3 * size_t { num_of_lines };
+        while (edges.size() < num_of_values) {
+            size_t old_size = edges.size();
+            edges.resize(std::min(num_of_values, std::max(2 * old_size, 3 * max_reserved)));
+            size_t num_of_bytes = (edges.size() - old_size) * sizeof(std::uint32_t);
+            input.read(reinterpret_cast<char*>(edges.data() + old_size), num_of_bytes);
+            if (static_cast<size_t>(input.gcount()) != num_of_bytes) {
+                throw std::logic_error(
+                    where + "the edge list is truncated, " + std::to_string(num_of_lines) + " edges expected. "
+                );
+            }
+        }
+        try {
+            return make_graph(num_of_nodes, std::move(edges), directed, policy);
+        } catch (const std::logic_error& error) {
+            throw std::logic_error(where + error.what());
+        }
+    }
+};
+
+} // namespace Tool
@@ -0,0 +1,315 @@
+/**
+ * @file euler_batch_solver.hpp
+ * @author Eden (edwardwang33773@gmail.com)
+ * @brief Solve euler circles of @b many graphs in one job, on a @b thread_pool
+ * @note
+        1. |-> the graphs are cut into @b chunks (about 8 per thread), each chunk is a @b task
+        2. |-> a task writes the result of graph `i` into @b slot `i` of the output,
+               so the output keeps the @b input_order , without any lock or sorting
+        3. |-> each worker owns a @b scratch engine ( @e LinearHierholzer ),
+               whose buffers are reused by every graph it solves
+
+        The graphs could also be read from a @b stream (by an @e IntegerReader ) =>
+            repeated { `num_of_vertex` , then `num_of_vertex ^ 2` elements of the Adjacency Matrix }
+        with the type of each graph decided by a @b DirectednessPolicy .
+        @b Sparse graphs come from an @e EdgeListReader , and are solved on their @b CSR directly.
+
+        Each graph is solved in its own @b MemoryScope ( @e memory_tracking.hpp ) =>
+        @b stats.peak_bytes of a result is what the query has allocated on top of the graph
+        (views, copies, engine buffers, the circle), and with @b set_memory_cap , a query going
+        over it is @b aborted (the others go on). The @b scratch of a worker is charged to the query
+        which grows it => later queries of the same size only pay for their circle.
+ * @version 0.1
+ * @date 2022-10-28
+ *
+ * @copyright Copyright (c) 2022
+ *
+ */
+
+#pragma once
+
+#include "batch_graph.hpp"
+#include "euler_result.hpp"
+#include "integer_reader.hpp"
+#include "linear_hierholzer.hpp"
+#include "memory_tracking.hpp"
+#include "thread_pool.hpp"
+#include "trace_events.hpp"
+#include <algorithm>
+#include <chrono>
+#include <istream>
+#include <new>
+#include <optional>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <variant>
+#include <vector>
+
+namespace Tool {
+
+/// @attention the original @b H ( @e walk_an_euler_circle_H ) is @p not here => it gives invalid circles
+///            on multigraphs (and on some simple ones), so it's only kept in the interactive mode
+enum class EulerAlgorithm : unsigned short {
+    H_linear  = 0, // on the worker's scratch engine (recommended)
+    H_fastest = 1,
+    F         = 2, // @b dense graphs only
+};
+
+class EulerBatchSolver : protected GeneralGraphToolSet {
+public:
+    struct Report {
+        size_t num_of_graphs        = 0;
+        size_t num_of_euler_circles = 0; // graphs which have one (trivial ones included)
+        size_t num_of_aborted       = 0; // over the memory cap
+        size_t peak_bytes           = 0; // max of all queries
+        size_t num_of_threads       = 0;
+        double seconds              = 0;
+
+        double return_graphs_per_second() const {
+            return seconds > 0 ? num_of_graphs / seconds : 0;
+        }
+    };
+
+private:
+    ThreadPool&                   Pool;
+    std::vector<LinearHierholzer> Engines;       // Engines[worker_index] => scratch
+    size_t                        MemoryCap = 0; // per query, 0 => none
+
+    static EulerResult solve(
+        BatchGraph&       input,
+        EulerAlgorithm    algorithm,
+        LinearHierholzer& scratch
+    ) {
+        return std::visit(
+            [algorithm, &scratch](auto& graph) {
+                using graph_type = std::decay_t<decltype(graph)>;
+                if constexpr (if_sparse_graph<graph_type>) {
+                    return solve_sparse(graph, algorithm, scratch);
+                } else {
+                    switch (algorithm) {
+                    case EulerAlgorithm::H_fastest:
+                        return graph_type::return_an_euler_circle_H_fastest(graph, 1);
+                    case EulerAlgorithm::F:
+                        return graph_type::return_an_euler_circle_F(graph, 1);
+                    default:
+                        return graph_type::return_an_euler_circle_H_linear(graph, 1, scratch);
+                    }
+                }
+            },
+            input
+        );
+    }
+    template <bool Directed>
+    static EulerResult solve_sparse(
+        SparseGraph<Directed>& graph,
+        EulerAlgorithm         algorithm,
+        LinearHierholzer&      scratch
+    ) {
+        if (algorithm == EulerAlgorithm::F) {
+            throw std::logic_error("Fleury Algorithm needs an Adjacency Matrix, not an edge list!");
+        }
+        if (!GeneralGraphToolSet::if_has_euler_circle(graph)) {
+            return EulerResult::no_euler_circle();
+        }
+        if (GeneralGraphToolSet::if_trivial(graph)) {
+            return EulerResult::trivial(1);
+        }
+        if (algorithm != EulerAlgorithm::H_linear) {
+            SparseGraph<Directed> copied = graph; // edges will be cut
+            return GeneralGraphToolSet::walk_an_euler_circle_H_fastest(copied, 1);
+        }
+        scratch.load(graph);
+
+        EulerResult res;
+        auto&       circle = scratch.run(1);
+        res.status         = EulerStatus::found;
+        res.vertices.assign(circle.begin(), circle.end());
+        res.stats.num_of_edges = scratch.return_num_of_edges();
+        res.stats.num_of_steps = scratch.return_num_of_edges();
+        return res;
+    }
+
+public:
+    explicit EulerBatchSolver(ThreadPool& inputPool)
+        : Pool(inputPool)
+        , Engines(inputPool.return_num_of_threads()) { }
+
+    /// @brief bytes a query could allocate (on top of its graph), @b 0 => no cap
+    void set_memory_cap(size_t bytes) {
+        MemoryCap = bytes;
+    }
+
+    /**
+     * @brief an euler circle from vertex `1` of each graph
+     * @param graphs only their @b cached_properties are filled
+     * @param results resized to `graphs.size()` , results[i] <=> graphs[i]
+     */
+    Report solve_all(
+        std::span<BatchGraph>     graphs,
+        std::vector<EulerResult>& results,
+        EulerAlgorithm            algorithm = EulerAlgorithm::H_linear
+    ) {
+        Report res;
+        res.num_of_graphs  = graphs.size();
+        res.num_of_threads = Pool.return_num_of_threads();
+
+        TraceSpan span("solve_chunk", "batch");
+        results.clear();
+        results.resize(graphs.size());
+
+        size_t chunk_size = std::max<size_t>(1, graphs.size() / (8 * res.num_of_threads));
+
+        auto begin = std::chrono::steady_clock::now();
+        for (size_t first = 0; first < graphs.size(); first += chunk_size) {
+            size_t last = std::min(first + chunk_size, graphs.size());
+            Pool.submit([this, graphs, &results, algorithm, first, last] {
+                TraceSpan         span("solve_range", "batch");
+                LinearHierholzer& scratch = Engines[Pool.return_worker_index()];
+                for (size_t index = first; index < last; ++index) {
+                    MemoryScope scope(MemoryCap);
+                    try {
+                        results[index] = solve(graphs[index], algorithm, scratch);
+                    } catch (const MemoryCapExceeded&) {
+                        results[index] = EulerResult::aborted();
+                    }
+                    results[index].stats.peak_bytes         = scope.return_usage().peak_bytes;
+                    results[index].stats.num_of_allocations = scope.return_usage().num_of_allocations;
+                }
+            });
+        }
+        Pool.wait();
+        auto end = std::chrono::steady_clock::now();
+
+        res.seconds = std::chrono::duration<double>(end - begin).count();
+        for (auto&& result : results) {
+            res.num_of_euler_circles += result.if_has_euler_circle();
+            res.num_of_aborted += result.status == EulerStatus::aborted;
+            res.peak_bytes = std::max(res.peak_bytes, result.stats.peak_bytes);
+        }
+        return res;
+    }
+    std::vector<EulerResult> solve_all(
+        std::span<BatchGraph> graphs,
+        EulerAlgorithm        algorithm = EulerAlgorithm::H_linear
+    ) {
+        std::vector<EulerResult> results;
+        solve_all(graphs, results, algorithm);
+        return results;
+    }
+
+    /// @brief @b type of a graph, see @e DirectednessPolicy
+    static bool if_directed(
+        const Matrix<int>::rows_type& initMat,
+        DirectednessPolicy            policy
+    ) {
+        if (policy != DirectednessPolicy::judge) {
+            return policy == DirectednessPolicy::directed;
+        }
+        size_t num_of_v = initMat.size();
+        for (size_t row = 0; row < num_of_v; ++row) {
+            if (initMat[row][row] % 2 != 0) {
+                return true;
+            }
+            for (size_t col = row + 1; col < num_of_v; ++col) {
+                if (initMat[row][col] != initMat[col][row]) {
+                    return true;
+                }
+            }
+        }
+        return false;
+    }
+
+    /**
+     * @brief read @b one graph, @b std::nullopt at the end of `input`
+     * @note each element is decoded straight into its row of the matrix, see @e integer_reader.hpp
+     * @param index of the graph (from `0`), only used in the error message
+     * @exception std::logic_error with the @b index of the bad graph, and the @b row / @b col of the bad element
+     */
+    static std::optional<BatchGraph> read_graph(
+        IntegerReader&     input,
+        DirectednessPolicy policy = DirectednessPolicy::judge,
+        size_t             index  = 0
+    ) {
+        std::string where    = "Graph #" + std::to_string(index) + ": ";
+        long long   num_of_v = 0;
+        try {
+            if (!input.read(num_of_v)) {
+                return std::nullopt;
+            }
+        } catch (const std::logic_error& error) {
+            throw std::logic_error(where + "num of vertex => " + error.what());
+        }
+        if (num_of_v <= 0) {
+            throw std::logic_error(
+                where + "num of vertex should >0 (line " + std::to_string(input.return_line()) + "). "
+            );
+        }
+        size_t num_of_nodes = static_cast<size_t>(num_of_v);
+        // a row is allocated once its first element is read => a huge (or wrong) num of vertex
+        // fails as a short matrix, not by allocating num_of_v ^ 2 elements ahead
+        Matrix<int>::rows_type initMat;
+        for (size_t row = 0; row < num_of_nodes; ++row) {
+            for (size_t col = 0; col < num_of_nodes; ++col) {
+                // only built on error => no allocation per element
+                auto where_cell = [&] {
+                    return "row " + std::to_string(row + 1) + ", col " + std::to_string(col + 1);
+                };
+                int  element = 0;
+                bool if_read = false;
+                try {
+                    if_read = input.read(element);
+                } catch (const std::logic_error& error) {
+                    throw std::logic_error(where + where_cell() + " => " + error.what());
+                }
+                if (!if_read) {
+                    throw std::logic_error(where + "the Adjacency Matrix ends before " + where_cell() + ". ");
+                }
+                if (col == 0) {
+                    try {
+                        initMat.emplace_back(num_of_nodes);
+                    } catch (const std::bad_alloc&) {
+                        throw std::logic_error(
+                            where + "out of memory for " + where_cell() + " (num of vertex "
+                            + std::to_string(num_of_nodes) + "). "
+                        );
+                    } catch (const std::length_error&) {
+                        throw std::logic_error(
+                            where + "num of vertex " + std::to_string(num_of_nodes) + " is too large. "
+                        );
+                    }
+                }
+                initMat[row][col] = element;
+                if (element < 0) {
+                    throw std::logic_error(
+                        where + where_cell() + " => line " + std::to_string(input.return_line())
+                        + ", column " + std::to_string(input.return_column()) + ": element <0. "
+                    );
+                }
+            }
+        }
+        try {
+            if (if_directed(initMat, policy)) {
+                return BatchGraph(std::in_place_type<directed_graph>, std::move(initMat));
+            }
+            return BatchGraph(std::in_place_type<undirected_graph>, std::move(initMat));
+        } catch (const std::logic_error& error) {
+            throw std::logic_error(where + error.what());
+        }
+    }
+    /// @brief read graphs until the end of `input`
+    static std::vector<BatchGraph> read_graphs(
+        std::istream&      input,
+        DirectednessPolicy policy = DirectednessPolicy::judge
+    ) {
+        IntegerReader           reader(input);
+        std::vector<BatchGraph> res;
+        while (auto graph = read_graph(reader, policy, res.size())) {
+            res.push_back(std::move(*graph));
+        }
+        return res;
+    }
+};
+
+} // namespace Tool
@@ -0,0 +1,312 @@
+/**
+ * @file euler_circle_counter.hpp
+ * @author Eden (edwardwang33773@gmail.com)
+ * @brief Count euler circles of a @b directed_graph by the @b BEST_theorem , @p without enumerating
+ * @note
+        For a @b connected , @b eulerian @e directed graph =>
+
+            ec(G) = t_w(G) * ∏_v ( out_deg(v) - 1 )!
+
+        t_w(G) => num of @b arborescences rooted at any vertex `w`
+                  ( @b Matrix_Tree_Theorem => det of the @b Laplacian ( L = D_out - A ),
+                  with the row and col of `w` removed )
+
+        Circles are counted @b cyclically (no fixed start edge), and
+        @b multi_edges are @b distinguishable (as in the theorem).
+
+        The determinant is computed @b exactly =>
+        1). |-> @p mod_prime    => Gaussian elimination in Z_p, T(n) = O( V^3 )
+        2). |-> @p exact        => the result is bounded by @b Hadamard's_bound ,
+                                   so it's computed modulo @b enough 62-bit primes,
+                                   then rebuilt by @b CRT (Garner) into a decimal string
+ * @version 0.1
+ * @date 2022-10-26
+ *
+ * @copyright Copyright (c) 2022
+ *
+ */
+
+#pragma once
+
+#include "graph_view.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace Tool {
+
+class EulerCircleCounter {
+    using u64  = std::uint64_t;
+    using u128 = unsigned __int128;
+
+    static constexpr u64 mul_mod(u64 lhs, u64 rhs, u64 mod) {
+        return static_cast<u64>(static_cast<u128>(lhs) * rhs % mod);
+    }
+    static constexpr u64 pow_mod(u64 base, u64 exp, u64 mod) {
+        u64 res = 1 % mod;
+        base %= mod;
+        while (exp) {
+            if (exp & 1) {
+                res = mul_mod(res, base, mod);
+            }
+            base = mul_mod(base, base, mod);
+            exp >>= 1;
+        }
+        return res;
+    }
+    /// @brief deterministic @b Miller_Rabin for 64-bit
+    static constexpr bool if_prime(u64 num) {
+        if (num < 2) {
+            return false;
+        }
+        for (u64 small : { 2, 3, 5, 7, 11, 13, 17, 19, 23, 29, 31, 37 }) {
+            if (num % small == 0) {
+                return num == small;
+            }
+        }
+        u64    odd   = num - 1;
+        size_t twice = 0;
+        while ((odd & 1) == 0) {
+            odd >>= 1;
+            ++twice;
+        }
+        for (u64 base : { 2, 325, 9375, 28178, 450775, 9780504, 1795265022 }) {
+            u64 curr = pow_mod(base, odd, num);
+            if (curr == 0 || curr == 1 || curr == num - 1) {
+                continue;
+            }
+            bool if_composite = true;
+            for (size_t i = 1; i < twice && if_composite; ++i) {
+                curr         = mul_mod(curr, curr, num);
+                if_composite = curr != num - 1;
+            }
+            if (if_composite) {
+                return false;
+            }
+        }
+        return true;
+    }
+    /// @brief the first `num` primes below 2^62, as a @b copy of the cache (grown under its lock)
+    static std::vector<u64> return_primes(size_t num) {
+        static std::mutex           lock;
+        static std::vector<u64>     primes;
+        std::lock_guard<std::mutex> guard(lock);
+        u64                         curr = primes.empty() ? (u64 { 1 } << 62) : primes.back();
+        while (primes.size() < num) {
+            do {
+                --curr;
+            } while (!if_prime(curr));
+            primes.push_back(curr);
+        }
+        return std::vector<u64>(primes.begin(), primes.begin() + num);
+    }
+
+    /// @brief @b reduced Laplacian (root removed), over @b non_isolated vertices only
+    template <GraphView G>
+    static std::vector<std::vector<long long>> return_reduced_laplacian(G& graph) {
+        size_t              num_of_nodes = graph.return_num_of_nodes();
+        std::vector<size_t> index_of(num_of_nodes + 1, 0); // 0 => isolated or root
+        size_t              num_of_rows = 0;
+        bool                if_has_root = false;
+        for (size_t vertex = 1; vertex <= num_of_nodes; ++vertex) {
+            if (graph.return_out_degree(vertex) == 0) {
+                continue;
+            }
+            if (!if_has_root) {
+                if_has_root = true; // the first non-isolated vertex
+                continue;
+            }
+            index_of[vertex] = ++num_of_rows;
+        }
+
+        std::vector<std::vector<long long>> laplacian(
+            num_of_rows,
+            std::vector<long long>(num_of_rows, 0)
+        );
+        for (size_t vertex = 1; vertex <= num_of_nodes; ++vertex) {
+            size_t row = index_of[vertex];
+            if (row == 0) {
+                continue;
+            }
+            laplacian[row - 1][row - 1] += graph.return_out_degree(vertex);
+            for (size_t col = graph.return_first_iterable(vertex);
+                 col != 0;
+                 col = graph.return_next_iterable(vertex, col)) {
+                if (index_of[col] != 0) {
+                    laplacian[row - 1][index_of[col] - 1]
+                        -= graph.return_multiplicity(vertex, col); // self ring cancels out
+                }
+            }
+        }
+        return laplacian;
+    }
+
+    /// @brief det in Z_p , by Gaussian elimination
+    static u64 return_det_mod(const std::vector<std::vector<long long>>& matrix, u64 prime) {
+        size_t                        size = matrix.size();
+        std::vector<std::vector<u64>> mat(size, std::vector<u64>(size));
+        for (size_t row = 0; row < size; ++row) {
+            for (size_t col = 0; col < size; ++col) {
+                long long curr = matrix[row][col] % static_cast<long long>(prime);
+                mat[row][col]  = curr < 0 ? curr + prime : curr;
+            }
+        }
+        u64 det = 1;
+        for (size_t col = 0; col < size; ++col) {
+            size_t pivot = col;
+            while (pivot < size && mat[pivot][col] == 0) {
+                ++pivot;
+            }
+            if (pivot == size) {
+                return 0;
+            }
+            if (pivot != col) {
+                std::swap(mat[pivot], mat[col]);
+                det = prime - det; // -det
+            }
+            det     = mul_mod(det, mat[col][col], prime);
+            u64 inv = pow_mod(mat[col][col], prime - 2, prime);
+            for (size_t row = col + 1; row < size; ++row) {
+                if (mat[row][col] == 0) {
+                    continue;
+                }
+                u64 factor = mul_mod(mat[row][col], inv, prime);
+                for (size_t curr = col; curr < size; ++curr) {
+                    mat[row][curr] = (mat[row][curr] + prime - mul_mod(factor, mat[col][curr], prime)) % prime;
+                }
+            }
+        }
+        return det % prime;
+    }
+
+    template <GraphView G>
+    static u64 return_factorials_mod(G& graph, u64 prime) {
+        u64 res = 1 % prime;
+        for (size_t vertex = 1; vertex <= graph.return_num_of_nodes(); ++vertex) {
+            for (size_t i = 2; i < graph.return_out_degree(vertex); ++i) {
+                res = mul_mod(res, i, prime);
+            }
+        }
+        return res;
+    }
+
+    /// @brief log2 of the upper bound of the result (Hadamard's bound * factorials)
+    template <GraphView G>
+    static double return_log2_bound(G& graph, const std::vector<std::vector<long long>>& laplacian) {
+        double res = 0;
+        for (auto&& row : laplacian) {
+            double sum_of_squares = 0;
+            for (auto&& curr : row) {
+                sum_of_squares += static_cast<double>(curr) * static_cast<double>(curr);
+            }
+            res += 0.5 * std::log2(std::max(sum_of_squares, 1.0));
+        }
+        for (size_t vertex = 1; vertex <= graph.return_num_of_nodes(); ++vertex) {
+            // (degree - 1)! , summed up => @b std::lgamma writes the global `signgam` (not thread-safe)
+            size_t degree = graph.return_out_degree(vertex);
+            for (size_t factor = 2; factor < degree; ++factor) {
+                res += std::log2(static_cast<double>(factor));
+            }
+        }
+        return res;
+    }
+
+    /// @brief digits[i] = 10^9 based, little endian
+    static void multiply_add(std::vector<std::uint32_t>& digits, u64 factor, u64 addend) {
+        u128 carry = addend;
+        for (auto&& digit : digits) {
+            u128 curr = static_cast<u128>(digit) * factor + carry;
+            digit     = static_cast<std::uint32_t>(curr % 1000000000);
+            carry     = curr / 1000000000;
+        }
+        while (carry) {
+            digits.push_back(static_cast<std::uint32_t>(carry % 1000000000));
+            carry /= 1000000000;
+        }
+    }
+    static std::string return_decimal(const std::vector<std::uint32_t>& digits) {
+        if (digits.empty()) {
+            return "0";
+        }
+        std::string res = std::to_string(digits.back());
+        for (size_t index = digits.size() - 1; index-- > 0;) {
+            std::string curr = std::to_string(digits[index]);
+            res += std::string(9 - curr.size(), '0') + curr;
+        }
+        return res;
+    }
+
+public:
+    EulerCircleCounter() = delete;
+
+    /**
+     * @brief num of euler circles, modulo `prime`
+     * @attention the graph @p must_have an euler circle (check it ahead),
+     *            `prime` @p must_be a prime below 2^63
+     */
+    template <GraphView G>
+        requires(G::if_directed)
+    static u64 return_num_of_euler_circles_mod(G& graph, u64 prime) {
+        if (!if_prime(prime) || prime >= (u64 { 1 } << 63)) {
+            throw std::logic_error("Modulus should be a prime below 2^63!");
+        }
+        if (graph.return_num_of_edges() == 0) {
+            return 1 % prime; // trivial
+        }
+        auto laplacian = return_reduced_laplacian(graph);
+        return mul_mod(
+            return_det_mod(laplacian, prime),
+            return_factorials_mod(graph, prime),
+            prime
+        );
+    }
+
+    /**
+     * @brief num of euler circles, @b exactly , as a decimal string
+     * @attention the graph @p must_have an euler circle (check it ahead)
+     */
+    template <GraphView G>
+        requires(G::if_directed)
+    static std::string return_num_of_euler_circles(G& graph) {
+        if (graph.return_num_of_edges() == 0) {
+            return "1"; // trivial
+        }
+        auto   laplacian     = return_reduced_laplacian(graph);
+        size_t num_of_primes = static_cast<size_t>(return_log2_bound(graph, laplacian) / 61) + 2;
+        auto   primes        = return_primes(num_of_primes);
+
+        // Garner => res = c[0] + c[1] * p[0] + c[2] * p[0] * p[1] + ...
+        std::vector<u64> coefficient(num_of_primes);
+        for (size_t curr = 0; curr < num_of_primes; ++curr) {
+            u64 prime   = primes[curr];
+            u64 residue = mul_mod(
+                return_det_mod(laplacian, prime),
+                return_factorials_mod(graph, prime),
+                prime
+            );
+            u64 value = 0; // c[0] + c[1] * p[0] + ... (mod prime)
+            u64 radix = 1; // p[0] * p[1] * ...      (mod prime)
+            for (size_t prev = 0; prev < curr; ++prev) {
+                value = (value + mul_mod(coefficient[prev] % prime, radix, prime)) % prime;
+                radix = mul_mod(radix, primes[prev] % prime, prime);
+            }
+            coefficient[curr] = mul_mod(
+                (residue + prime - value) % prime,
+                pow_mod(radix, prime - 2, prime),
+                prime
+            );
+        }
+
+        std::vector<std::uint32_t> digits;
+        for (size_t curr = num_of_primes; curr-- > 0;) {
+            multiply_add(digits, primes[curr], coefficient[curr]); // Horner
+        }
+        return return_decimal(digits);
+    }
+};
+
+} // namespace Tool
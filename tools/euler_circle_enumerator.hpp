@@ -0,0 +1,318 @@
+/**
+ * @file euler_circle_enumerator.hpp
+ * @author Eden (edwardwang33773@gmail.com)
+ * @brief Enumerate @b all distinct euler circles from a vertex, @b lazily
+ * @note
+        @b Backtracking over a CSR of @b distinct_neighbors (with remaining multiplicity),
+        so @b multi_edges never produce the same vertex sequence twice.
+
+        @b Bridge_pruning (the rule of @e Fleury ) => an edge `v -> u` is tried only if
+        all remaining edges could still be reached from `u` after cutting it,
+        so @b every branch ends in a circle (there's @p no_dead_end ).
+        If there's only @b one distinct neighbor left, the check is skipped
+        (the current state is always completable, so that neighbor must be fine).
+
+        Each circle is yielded as a @b span into @b one reused buffer =>
+        it's valid until the consumer asks for the next one.
+        The consumer could @b stop_early , the rest is @p never_searched .
+
+        S(n) = O( V + E ) (no recursion, the search stack is flat)
+ * @version 0.1
+ * @date 2022-10-26
+ *
+ * @copyright Copyright (c) 2022
+ *
+ */
+
+#pragma once
+
+#include "generator.hpp"
+#include "graph_view.hpp"
+#include <algorithm>
+#include <cstdint>
+#include <span>
+#include <utility>
+#include <vector>
+
+namespace Tool {
+
+class EulerCircleEnumerator {
+    bool   if_directed  = true;
+    size_t num_of_nodes = 0;
+    size_t num_of_edges = 0;
+
+    std::vector<size_t>        SlotBegin;        // SlotBegin[vertex] .. SlotBegin[vertex + 1] => slots of `vertex`
+    std::vector<std::uint32_t> SlotTarget;       // SlotTarget[slot] => the distinct neighbor
+    std::vector<std::uint32_t> SlotTwin;         // SlotTwin[slot] => slot of the other side, @e undirected only
+    std::vector<std::uint32_t> InitMultiplicity; // InitMultiplicity[slot] => num of edges
+
+    // state of the search
+    std::vector<std::uint32_t> Multiplicity; // Multiplicity[slot] => remaining edges
+    std::vector<size_t>        Degree;       // Degree[vertex] => remaining edges (self ring counts `1`)
+    size_t                     NumOf_Remaining = 0;
+    size_t                     NumOf_Active    = 0; // num of vertices with Degree > 0
+
+    std::vector<std::uint32_t> Path;   // Path[depth] => vertex
+    std::vector<size_t>        Cursor; // Cursor[depth] => next slot to try
+    std::vector<size_t>        Taken;  // Taken[depth] => slot taken from Path[depth]
+
+    std::vector<std::uint32_t> Visited; // Visited[vertex] == Stamp => reached
+    std::uint32_t              Stamp = 0;
+    std::vector<std::uint32_t> Queue;
+
+    void cut_an_edge_of(std::uint32_t vertex, size_t slot) {
+        --Multiplicity[slot];
+        NumOf_Active -= --Degree[vertex] == 0;
+        std::uint32_t col = SlotTarget[slot];
+        if (!if_directed && col != vertex) {
+            --Multiplicity[SlotTwin[slot]];
+            NumOf_Active -= --Degree[col] == 0;
+        }
+        --NumOf_Remaining;
+    }
+    void add_an_edge_of(std::uint32_t vertex, size_t slot) {
+        ++Multiplicity[slot];
+        NumOf_Active += Degree[vertex]++ == 0;
+        std::uint32_t col = SlotTarget[slot];
+        if (!if_directed && col != vertex) {
+            ++Multiplicity[SlotTwin[slot]];
+            NumOf_Active += Degree[col]++ == 0;
+        }
+        ++NumOf_Remaining;
+    }
+
+    /// @brief judge if every vertex with remaining edges could be reached from `vertex`
+    bool if_all_reachable_from(std::uint32_t vertex) {
+        if (++Stamp == 0) {
+            std::fill(Visited.begin(), Visited.end(), 0);
+            Stamp = 1;
+        }
+        size_t num_of_reached = 0;
+        Queue.clear();
+        Queue.push_back(vertex);
+        Visited[vertex] = Stamp;
+        for (size_t index = 0; index < Queue.size(); ++index) {
+            std::uint32_t curr = Queue[index];
+            num_of_reached += Degree[curr] > 0;
+            for (size_t slot = SlotBegin[curr]; slot < SlotBegin[curr + 1]; ++slot) {
+                std::uint32_t col = SlotTarget[slot];
+                if (Multiplicity[slot] > 0 && Visited[col] != Stamp) {
+                    Visited[col] = Stamp;
+                    Queue.push_back(col);
+                }
+            }
+        }
+        return num_of_reached == NumOf_Active;
+    }
+
+public:
+    EulerCircleEnumerator() = default;
+
+    /**
+     * @brief flatten the @b GraphView into distinct neighbor lists, T(n) = O( V + E )
+     * @note the view itself is @p not_modified
+     */
+    template <GraphView G>
+    void load(G& graph) {
+        if_directed  = G::if_directed;
+        num_of_nodes = graph.return_num_of_nodes();
+        num_of_edges = 0;
+        SlotBegin.assign(num_of_nodes + 2, 0);
+        SlotTarget.clear();
+        InitMultiplicity.clear();
+        std::vector<std::pair<std::uint32_t, std::uint32_t>> sorted;
+        for (size_t vertex = 1; vertex <= num_of_nodes; ++vertex) {
+            SlotBegin[vertex] = SlotTarget.size();
+            for (size_t col = graph.return_first_iterable(vertex);
+                 col != 0;
+                 col = graph.return_next_iterable(vertex, col)) {
+                size_t multiplicity = graph.return_multiplicity(vertex, col);
+                SlotTarget.push_back(col);
+                InitMultiplicity.push_back(multiplicity);
+                if (G::if_directed || col >= vertex) {
+                    num_of_edges += multiplicity;
+                }
+            }
+            // ascending targets => twins could be matched in one pass
+            sorted.clear();
+            for (size_t slot = SlotBegin[vertex]; slot < SlotTarget.size(); ++slot) {
+                sorted.emplace_back(SlotTarget[slot], InitMultiplicity[slot]);
+            }
+            std::sort(sorted.begin(), sorted.end());
+            for (size_t index = 0; index < sorted.size(); ++index) {
+                SlotTarget[SlotBegin[vertex] + index]       = sorted[index].first;
+                InitMultiplicity[SlotBegin[vertex] + index] = sorted[index].second;
+            }
+        }
+        SlotBegin[num_of_nodes + 1] = SlotTarget.size();
+
+        if constexpr (!G::if_directed) {
+            // slots of `col` towards smaller vertices come first, in ascending order
+            SlotTwin.assign(SlotTarget.size(), 0);
+            std::vector<size_t> fill(SlotBegin.begin(), SlotBegin.end() - 1);
+            for (size_t vertex = 1; vertex <= num_of_nodes; ++vertex) {
+                for (size_t slot = SlotBegin[vertex]; slot < SlotBegin[vertex + 1]; ++slot) {
+                    std::uint32_t col = SlotTarget[slot];
+                    if (col > vertex) {
+                        size_t twin    = fill[col]++;
+                        SlotTwin[slot] = twin;
+                        SlotTwin[twin] = slot;
+                    }
+                }
+            }
+        }
+    }
+
+    /**
+     * @brief restart the search at `vertex` (the path is just `vertex` itself)
+     * @return @b false if there's @b no_circle from `vertex`
+     */
+    bool reset(std::uint32_t vertex) {
+        if (vertex == 0 || vertex > num_of_nodes) {
+            return false;
+        }
+        Multiplicity = InitMultiplicity;
+        Degree.assign(num_of_nodes + 1, 0);
+        NumOf_Active = 0;
+        for (size_t curr = 1; curr <= num_of_nodes; ++curr) {
+            for (size_t slot = SlotBegin[curr]; slot < SlotBegin[curr + 1]; ++slot) {
+                Degree[curr] += Multiplicity[slot];
+            }
+            NumOf_Active += Degree[curr] > 0;
+        }
+        if (num_of_edges != 0 && Degree[vertex] == 0) {
+            return false; // isolated
+        }
+        NumOf_Remaining = num_of_edges;
+        Visited.assign(num_of_nodes + 1, 0);
+        Stamp = 0;
+        Queue.reserve(num_of_nodes);
+        Path.assign(1, vertex);
+        Path.reserve(num_of_edges + 1);
+        Cursor.assign(1, SlotBegin[vertex]);
+        Cursor.reserve(num_of_edges + 1);
+        Taken.clear();
+        Taken.reserve(num_of_edges);
+        return true;
+    }
+
+    /// @brief @b feasible slots from the end of the path (the search state is kept)
+    void return_options(std::vector<size_t>& options) {
+        options.clear();
+        std::uint32_t curr_vertex = Path.back();
+        for (size_t slot = SlotBegin[curr_vertex]; slot < SlotBegin[curr_vertex + 1]; ++slot) {
+            if (Multiplicity[slot] > 0) {
+                options.push_back(slot);
+            }
+        }
+        if (options.size() <= 1) {
+            return;
+        }
+        size_t num_of_feasible = 0;
+        for (auto&& slot : options) {
+            cut_an_edge_of(curr_vertex, slot);
+            if (if_all_reachable_from(SlotTarget[slot])) {
+                options[num_of_feasible++] = slot;
+            }
+            add_an_edge_of(curr_vertex, slot);
+        }
+        options.resize(num_of_feasible);
+    }
+    /// @brief extend the path through `slot` (one of @b return_options )
+    void take(size_t slot) {
+        cut_an_edge_of(Path.back(), slot);
+        Taken.push_back(slot);
+        Path.push_back(SlotTarget[slot]);
+        Cursor.push_back(SlotBegin[SlotTarget[slot]]);
+    }
+    bool if_complete() const {
+        return NumOf_Remaining == 0;
+    }
+    std::span<const std::uint32_t> return_path() const {
+        return Path;
+    }
+    /// @brief slots taken so far, @b replay them with @b take after @b reset
+    std::span<const size_t> return_taken() const {
+        return Taken;
+    }
+
+    /**
+     * @brief enumerate circles which extend the @b current path, @b lazily
+     * @attention this enumerator @p must_outlive the generator
+     * @return each circle as a span into the internal buffer
+     */
+    Generator<std::span<const std::uint32_t>> run_subtree() {
+        size_t base = Taken.size();
+        while (true) {
+            std::uint32_t curr_vertex = Path.back();
+            bool          if_found    = false;
+            if (NumOf_Remaining == 0) {
+                co_yield std::span<const std::uint32_t>(Path);
+            } else {
+                size_t  end_slot       = SlotBegin[curr_vertex + 1];
+                size_t& curr_slot      = Cursor.back();
+                size_t  num_of_options = 0;
+                for (size_t slot = SlotBegin[curr_vertex]; slot < end_slot; ++slot) {
+                    num_of_options += Multiplicity[slot] > 0;
+                }
+                while (curr_slot < end_slot && !if_found) {
+                    size_t slot = curr_slot++;
+                    if (Multiplicity[slot] == 0) {
+                        continue;
+                    }
+                    cut_an_edge_of(curr_vertex, slot);
+                    if (num_of_options == 1 || if_all_reachable_from(SlotTarget[slot])) {
+                        Taken.push_back(slot);
+                        Path.push_back(SlotTarget[slot]);
+                        Cursor.push_back(SlotBegin[SlotTarget[slot]]);
+                        if_found = true;
+                    } else {
+                        add_an_edge_of(curr_vertex, slot); // it's a bridge, restore
+                    }
+                }
+            }
+            if (if_found) {
+                continue;
+            }
+            // backtrack
+            if (Taken.size() == base) {
+                co_return;
+            }
+            Path.pop_back();
+            Cursor.pop_back();
+            add_an_edge_of(Path.back(), Taken.back());
+            Taken.pop_back();
+        }
+    }
+
+    /**
+     * @brief enumerate circles from `vertex` , @b lazily
+     * @attention
+            1. the loaded graph @p must_have an euler circle (check it ahead)
+            2. this enumerator @p must_outlive the generator (see @b enumerate for an owning one)
+     * @return each circle ( @b first == @b last == `vertex` ), as a span into the internal buffer
+     */
+    Generator<std::span<const std::uint32_t>> run(std::uint32_t vertex) {
+        if (!reset(vertex)) {
+            return {};
+        }
+        return run_subtree();
+    }
+
+    /// @brief same as @b run , but the generator @b owns the enumerator
+    static Generator<std::span<const std::uint32_t>>
+    enumerate(EulerCircleEnumerator engine, std::uint32_t vertex) {
+        for (auto&& circle : engine.run(vertex)) {
+            co_yield circle;
+        }
+    }
+
+    constexpr size_t return_num_of_nodes() {
+        return num_of_nodes;
+    }
+    constexpr size_t return_num_of_edges() {
+        return num_of_edges;
+    }
+};
+
+} // namespace Tool
@@ -0,0 +1,167 @@
+/**
+ * @file euler_circle_set.hpp
+ * @author Eden (edwardwang33773@gmail.com)
+ * @brief Euler circles starting from @b every_vertex , by @b rotating only one circle
+ * @note
+        An euler circle passes @b every_edge , so it passes every @b non_isolated_vertex .
+        Then the circle starting from `vertex` is just a @b rotation of any one circle,
+        cut at the @b first_occurrence of `vertex`.
+
+        So we build @b one circle (linear Hierholzer), and an index of
+        @b first_occurrence for each vertex, then hand out @b rotated_views lazily.
+
+        T(n) = O( V + E ) for the whole set (instead of O( V * single_circle ))
+ * @version 0.1
+ * @date 2022-10-24
+ *
+ * @copyright Copyright (c) 2022
+ *
+ */
+
+#pragma once
+
+#include "graph_view.hpp"
+#include "linear_hierholzer.hpp"
+#include "trace_events.hpp"
+#include <cstdint>
+#include <stdexcept>
+#include <vector>
+
+namespace Tool {
+
+class EulerCircleSet {
+    static constexpr size_t not_passed = static_cast<size_t>(-1);
+
+    bool                         if_has_circle = false;
+    TrackedVector<std::uint32_t> Circle;          // first == last
+    TrackedVector<size_t>        FirstOccurrence; // FirstOccurrence[vertex], `not_passed` if isolated
+
+public:
+    /// @brief @b lazy view of the circle rotated to start (and end) at one vertex
+    class RotatedCircle {
+        const TrackedVector<std::uint32_t>* Circle = nullptr;
+        size_t                              Offset = 0;
+
+    public:
+        class iterator {
+            const RotatedCircle* Owner = nullptr;
+            size_t               Index = 0;
+
+        public:
+            using value_type      = std::uint32_t;
+            using difference_type = std::ptrdiff_t;
+
+            iterator() = default;
+            iterator(const RotatedCircle* owner, size_t index)
+                : Owner(owner)
+                , Index(index) { }
+
+            std::uint32_t operator*() const {
+                return (*Owner)[Index];
+            }
+            iterator& operator++() {
+                ++Index;
+                return *this;
+            }
+            iterator operator++(int) {
+                iterator res = *this;
+                ++Index;
+                return res;
+            }
+            friend bool operator==(const iterator& lhs, const iterator& rhs) {
+                return lhs.Index == rhs.Index;
+            }
+        };
+
+        RotatedCircle(const TrackedVector<std::uint32_t>* circle, size_t offset)
+            : Circle(circle)
+            , Offset(offset) { }
+
+        /// @brief num of vertices (num of edges + 1)
+        size_t size() const {
+            return Circle->size();
+        }
+        std::uint32_t operator[](size_t index) const {
+            size_t num_of_edges = Circle->size() - 1;
+            if (num_of_edges == 0) {
+                return Circle->front();
+            }
+            return (*Circle)[(Offset + index) % num_of_edges];
+        }
+        iterator begin() const {
+            return { this, 0 };
+        }
+        iterator end() const {
+            return { this, size() };
+        }
+        /// @brief materialize the view
+        TrackedVector<std::uint32_t> to_vector() const {
+            TrackedVector<std::uint32_t> res;
+            res.reserve(size());
+            for (size_t index = 0; index < size(); ++index) {
+                res.push_back((*this)[index]);
+            }
+            return res;
+        }
+    };
+
+    /// @brief empty set => @b no_euler_circle
+    EulerCircleSet() = default;
+
+    /**
+     * @brief build @b one circle and the @b first_occurrence index
+     * @attention the graph @p must_have an euler circle (check it ahead)
+     * @note the view itself is @p not_modified
+     */
+    template <GraphView G>
+    static EulerCircleSet build(G& graph) {
+        TraceSpan      span("build_circle_set", "construction");
+        EulerCircleSet res;
+        res.if_has_circle = true;
+        res.FirstOccurrence.assign(graph.return_num_of_nodes() + 1, not_passed);
+
+        if (graph.return_num_of_edges() == 0) { // trivial
+            res.Circle             = { 1 };
+            res.FirstOccurrence[1] = 0;
+            return res;
+        }
+
+        size_t start = 1;
+        while (graph.return_out_degree(start) == 0) {
+            ++start;
+        }
+        LinearHierholzer engine;
+        engine.load(graph);
+        res.Circle = std::move(engine.run(start));
+
+        for (size_t index = 0; index < res.Circle.size(); ++index) {
+            size_t& first = res.FirstOccurrence[res.Circle[index]];
+            if (first == not_passed) {
+                first = index;
+            }
+        }
+        return res;
+    }
+
+    bool if_has_euler_circle() const {
+        return if_has_circle;
+    }
+    /// @brief judge if there's a circle starting from `vertex`
+    bool if_passed(size_t vertex) const {
+        return if_has_circle
+            && vertex < FirstOccurrence.size()
+            && FirstOccurrence[vertex] != not_passed;
+    }
+    /// @brief the circle starting from `vertex` , O(1)
+    RotatedCircle operator[](size_t vertex) const {
+        if (!if_passed(vertex)) {
+            throw std::out_of_range("No euler circle passes this vertex!");
+        }
+        return { &Circle, FirstOccurrence[vertex] };
+    }
+    size_t return_num_of_nodes() const {
+        return FirstOccurrence.empty() ? 0 : FirstOccurrence.size() - 1;
+    }
+};
+
+} // namespace Tool
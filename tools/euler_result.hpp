@@ -0,0 +1,69 @@
+/**
+ * @file euler_result.hpp
+ * @author Eden (edwardwang33773@gmail.com)
+ * @brief Structured result of an euler circle algorithm (instead of a pre-formatted string)
+ * @note
+        @b status   => found / trivial / no_euler_circle / aborted (over the @b memory_cap )
+        @b vertices => the circle in @b one flat buffer ( @b first == @b last == start )
+                       @e trivial => just the start vertex
+                       @e no_euler_circle / @e aborted => empty
+        @b stats    => what the algorithm has done
+
+        Formatting is a @b separate step, see @e euler_result_format.hpp
+ * @version 0.1
+ * @date 2022-10-27
+ *
+ * @copyright Copyright (c) 2022
+ *
+ */
+
+#pragma once
+
+#include "memory_tracking.hpp"
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace Tool {
+
+enum class EulerStatus : unsigned short {
+    found           = 0,
+    trivial         = 1,
+    no_euler_circle = 2,
+    aborted         = 3,
+};
+
+struct EulerStats {
+    size_t num_of_edges      = 0; // edges of the graph
+    size_t num_of_steps      = 0; // edges walked (including the ones walked back)
+    size_t num_of_backtracks = 0; // Hierholzer => sub-circles closed, Fleury => bridges refused
+
+    // of the query, filled by whoever opens its @b MemoryScope , see @e memory_tracking.hpp
+    size_t peak_bytes         = 0;
+    size_t num_of_allocations = 0;
+};
+
+struct EulerResult {
+    EulerStatus                  status = EulerStatus::no_euler_circle;
+    TrackedVector<std::uint32_t> vertices;
+    EulerStats                   stats;
+
+    static EulerResult no_euler_circle() {
+        return {};
+    }
+    static EulerResult trivial(size_t vertex) {
+        return { EulerStatus::trivial, { static_cast<std::uint32_t>(vertex) }, {} };
+    }
+    static EulerResult aborted() {
+        return { EulerStatus::aborted, {}, {} };
+    }
+
+    bool if_has_euler_circle() const {
+        return status == EulerStatus::found || status == EulerStatus::trivial;
+    }
+    std::span<const std::uint32_t> return_vertices() const {
+        return vertices;
+    }
+};
+
+} // namespace Tool
@@ -0,0 +1,73 @@
+/**
+ * @file euler_result_format.hpp
+ * @author Eden (edwardwang33773@gmail.com)
+ * @brief Format an @b EulerResult into text, by @b std::to_chars
+ * @note
+        found           => "1 -> 2 -> 1 -> fin. "
+        trivial         => "Trivial -> 1 -> fin. "
+        no_euler_circle => "NO euler circle! "
+        aborted         => "Aborted (memory cap exceeded)! "
+
+        The output string is @b reserved once, and each vertex is written by
+        @b std::to_chars into a stack buffer => @p no_allocation per vertex .
+        @b format_to appends, so one string could be reused for many results.
+ * @version 0.1
+ * @date 2022-10-27
+ *
+ * @copyright Copyright (c) 2022
+ *
+ */
+
+#pragma once
+
+#include "euler_result.hpp"
+#include <charconv>
+#include <cstdint>
+#include <limits>
+#include <string>
+
+namespace Tool {
+
+class EulerResultFormatter {
+public:
+    static constexpr size_t max_digits = std::numeric_limits<std::uint32_t>::digits10 + 1;
+
+    EulerResultFormatter() = delete;
+
+    static void append_vertex(std::string& output, std::uint32_t vertex) {
+        char buffer[max_digits];
+        auto [end, error] = std::to_chars(buffer, buffer + max_digits, vertex);
+        output.append(buffer, end);
+    }
+
+    static void format_to(std::string& output, const EulerResult& result) {
+        switch (result.status) {
+        case EulerStatus::no_euler_circle:
+            output += "NO euler circle! ";
+            return;
+        case EulerStatus::aborted:
+            output += "Aborted (memory cap exceeded)! ";
+            return;
+        case EulerStatus::trivial:
+            output += "Trivial -> ";
+            append_vertex(output, result.vertices.front());
+            output += " -> fin. ";
+            return;
+        case EulerStatus::found:
+            output.reserve(output.size() + result.vertices.size() * (max_digits + 4) + 5);
+            for (auto&& vertex : result.vertices) {
+                append_vertex(output, vertex);
+                output += " -> ";
+            }
+            output += "fin. ";
+            return;
+        }
+    }
+    static std::string format(const EulerResult& result) {
+        std::string output;
+        format_to(output, result);
+        return output;
+    }
+};
+
+} // namespace Tool
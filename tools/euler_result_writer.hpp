@@ -0,0 +1,266 @@
+/**
+ * @file euler_result_writer.hpp
+ * @author Eden (edwardwang33773@gmail.com)
+ * @brief EulerResultWriter => a @b buffered sink of @b EulerResult , written in @b bulk
+ * @note
+        `std::cout << ... << std::endl` per line => @b one flush (a @b syscall ) per line,
+        so a long circle is bound by syscalls. Here results are formatted into @b one buffer,
+        which is written only when it's full (or by @b flush / the destructor) =>
+
+            @b std::ostream => one @b write() of the whole buffer
+            @b fd           => @b ::write() to a file descriptor, no @b iostream at all
+
+        @b OutputFormat , one result per record =>
+            @b text   => "1 -> 2 -> 1 -> fin. "          ( @e euler_result_format.hpp )
+            @b csv    => index,status,num_of_vertices,vertices   ( @b header row first,
+                         vertices => "1 2 1" )
+            @b jsonl  => {"index":0,"status":"found","vertices":[1,2,1]}
+            @b binary => @b uint32 , @p native_byte_order => status, num_of_vertices, vertices...
+                         (status => 0 found, 1 trivial, 2 no_euler_circle, 3 aborted)
+
+        The buffer is checked after each vertex => a @b long circle never grows it past
+        @b buffer_size by much, the memory is bounded.
+
+        @b write_line => a raw line (headers of the interactive mode), only for @b text
+ * @version 0.1
+ * @date 2022-10-28
+ *
+ * @copyright Copyright (c) 2022
+ *
+ */
+
+#pragma once
+
+#include "euler_result.hpp"
+#include "euler_result_format.hpp"
+#include "trace_events.hpp"
+#include <algorithm>
+#include <cerrno>
+#include <cstdint>
+#include <cstring>
+#include <ostream>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+
+#if defined(_WIN32)
+#include <fcntl.h>
+#include <io.h>
+#else
+#include <unistd.h>
+#endif
+
+namespace Tool {
+
+enum class OutputFormat : unsigned short {
+    text   = 0,
+    csv    = 1,
+    jsonl  = 2,
+    binary = 3,
+};
+
+class EulerResultWriter {
+    std::ostream* Stream = nullptr; // one of them
+    int           Fd     = -1;
+    OutputFormat  Format;
+    size_t        BufferSize;
+    std::string   Buffer;
+    size_t        NumOf_Results = 0;
+
+    void write_buffer() {
+        if (Buffer.empty()) {
+            return;
+        }
+        TraceSpan span("write_output", "format");
+        if (Stream) {
+            Stream->write(Buffer.data(), static_cast<std::streamsize>(Buffer.size()));
+            if (!*Stream) {
+                throw std::logic_error("Cannot write the results. ");
+            }
+            Buffer.clear();
+            return;
+        }
+        const char* begin = Buffer.data();
+        size_t      rest  = Buffer.size();
+        while (rest > 0) {
+#if defined(_WIN32)
+            auto num_of_written = ::_write(Fd, begin, static_cast<unsigned>(std::min<size_t>(rest, 1u << 30)));
+#else
+            auto num_of_written = ::write(Fd, begin, rest);
+#endif
+            if (num_of_written < 0) {
+                if (errno == EINTR) {
+                    continue;
+                }
+                throw std::logic_error("Cannot write the results: " + std::string(std::strerror(errno)));
+            }
+            begin += num_of_written;
+            rest -= static_cast<size_t>(num_of_written);
+        }
+        Buffer.clear();
+    }
+    void write_if_full() {
+        if (Buffer.size() >= BufferSize) {
+            write_buffer();
+        }
+    }
+    void append_binary(std::uint32_t value) {
+        Buffer.append(reinterpret_cast<const char*>(&value), sizeof(value));
+    }
+    static std::string_view return_status_name(EulerStatus status) {
+        switch (status) {
+        case EulerStatus::found:
+            return "found";
+        case EulerStatus::trivial:
+            return "trivial";
+        case EulerStatus::aborted:
+            return "aborted";
+        default:
+            return "no_euler_circle";
+        }
+    }
+
+    void write_text(const EulerResult& result) {
+        if (result.status != EulerStatus::found) {
+            EulerResultFormatter::format_to(Buffer, result);
+        } else {
+            for (auto&& vertex : result.vertices) {
+                EulerResultFormatter::append_vertex(Buffer, vertex);
+                Buffer += " -> ";
+                write_if_full();
+            }
+            Buffer += "fin. ";
+        }
+        Buffer += '\n';
+    }
+    void write_csv(const EulerResult& result) {
+        if (NumOf_Results == 0) {
+            Buffer += "index,status,num_of_vertices,vertices\n";
+        }
+        EulerResultFormatter::append_vertex(Buffer, static_cast<std::uint32_t>(NumOf_Results));
+        Buffer += ',';
+        Buffer += return_status_name(result.status);
+        Buffer += ',';
+        EulerResultFormatter::append_vertex(Buffer, static_cast<std::uint32_t>(result.vertices.size()));
+        Buffer += ',';
+        for (size_t index = 0; index < result.vertices.size(); ++index) {
+            if (index != 0) {
+                Buffer += ' ';
+            }
+            EulerResultFormatter::append_vertex(Buffer, result.vertices[index]);
+            write_if_full();
+        }
+        Buffer += '\n';
+    }
+    void write_jsonl(const EulerResult& result) {
+        Buffer += "{\"index\":";
+        EulerResultFormatter::append_vertex(Buffer, static_cast<std::uint32_t>(NumOf_Results));
+        Buffer += ",\"status\":\"";
+        Buffer += return_status_name(result.status);
+        Buffer += "\",\"vertices\":[";
+        for (size_t index = 0; index < result.vertices.size(); ++index) {
+            if (index != 0) {
+                Buffer += ',';
+            }
+            EulerResultFormatter::append_vertex(Buffer, result.vertices[index]);
+            write_if_full();
+        }
+        Buffer += "]}\n";
+    }
+    void write_binary(const EulerResult& result) {
+        append_binary(static_cast<std::uint32_t>(result.status));
+        append_binary(static_cast<std::uint32_t>(result.vertices.size()));
+        for (auto&& vertex : result.vertices) {
+            append_binary(vertex);
+            write_if_full();
+        }
+    }
+
+public:
+    static constexpr size_t default_buffer_size = size_t { 1 } << 16;
+
+    explicit EulerResultWriter(
+        std::ostream& output,
+        OutputFormat  format      = OutputFormat::text,
+        size_t        buffer_size = default_buffer_size
+    )
+        : Stream(&output)
+        , Format(format)
+        , BufferSize(std::max<size_t>(buffer_size, 1)) {
+        Buffer.reserve(BufferSize + 64);
+    }
+    /// @param fd an @b open file descriptor, @b not closed by the writer ( @b 1 => stdout)
+    explicit EulerResultWriter(
+        int          fd,
+        OutputFormat format      = OutputFormat::text,
+        size_t       buffer_size = default_buffer_size
+    )
+        : Fd(fd)
+        , Format(format)
+        , BufferSize(std::max<size_t>(buffer_size, 1)) {
+#if defined(_WIN32)
+        ::_setmode(Fd, Format == OutputFormat::binary ? _O_BINARY : _O_TEXT);
+#endif
+        Buffer.reserve(BufferSize + 64);
+    }
+    EulerResultWriter(const EulerResultWriter&)            = delete;
+    EulerResultWriter& operator=(const EulerResultWriter&) = delete;
+    ~EulerResultWriter() {
+        try {
+            flush();
+        } catch (...) {
+            // nothing could be reported here, call `flush()` ahead to see the error
+        }
+    }
+
+    EulerResultWriter& write(const EulerResult& result) {
+        TraceSpan span("format_result", "format");
+        switch (Format) {
+        case OutputFormat::csv:
+            write_csv(result);
+            break;
+        case OutputFormat::jsonl:
+            write_jsonl(result);
+            break;
+        case OutputFormat::binary:
+            write_binary(result);
+            break;
+        default:
+            write_text(result);
+            break;
+        }
+        ++NumOf_Results;
+        write_if_full();
+        return *this;
+    }
+    EulerResultWriter& write(std::span<const EulerResult> results) {
+        for (auto&& result : results) {
+            write(result);
+        }
+        return *this;
+    }
+    /// @brief a raw line + '\n' , ignored unless @b text (it would break the other formats)
+    EulerResultWriter& write_line(std::string_view line) {
+        if (Format == OutputFormat::text) {
+            Buffer += line;
+            Buffer += '\n';
+            write_if_full();
+        }
+        return *this;
+    }
+    /// @brief write the buffer out, and @b flush the stream (if any)
+    /// @exception std::logic_error if the sink refuses
+    void flush() {
+        write_buffer();
+        if (Stream) {
+            Stream->flush();
+        }
+    }
+
+    size_t return_num_of_results() const {
+        return NumOf_Results;
+    }
+};
+
+} // namespace Tool
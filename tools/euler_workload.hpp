@@ -0,0 +1,479 @@
+/**
+ * @file euler_workload.hpp
+ * @author Eden (edwardwang33773@gmail.com)
+ * @brief EulerWorkload => @b deterministic eulerian graphs (the same @b seed => the same graph,
+ *        on any standard library),
+ *        streamed edge by edge, so any size fits (no @b dense_matrix is needed)
+ * @note
+        @b Families (every one is @b connective and @b eulerian ) =>
+            @b cycle             => 1 -> 2 -> ... -> n -> 1
+            @b complete          => K_n ( @e undirected => n should be odd)
+            @b random_multigraph => degrees drawn from @b degree_weights ( weights[d] ~ P(degree == d) ),
+                                    a random @b Hamilton_cycle (=> connective), then the rest of the
+                                    @b stubs are paired at random ( @b configuration_model ,
+                                    self rings and multi edges are kept)
+                                    @e undirected => degree rounded up to even, >= 2
+                                    @e directed   => in_degree == out_degree == degree, >= 1
+            @b de_bruijn         => B(k, n) , k^n vertices (words), u -> (u * k + letter) mod k^n
+            @b torus             => rows x cols grid, wrapped, each vertex => @b right and @b down
+            @b union_of_cycles   => a random Hamilton cycle + random cycles (distinct vertices,
+                                    @b max_cycle_length at most), until exactly @b num_of_edges
+
+        @b Output =>
+            @b edges()             => a @e Generator of { from, to } , vertices from `1`
+            @b return_edge_list()  => { from, to, 1 } triples, for @e SparseGraph::build
+            @b to_graph<D>()       => @e directed_graph / @e undirected_graph (small ones only)
+            @b to_sparse_graph<D>()
+            @b write_text / @b write_binary => the formats of @e edge_list_reader.hpp ,
+                                              written in @b blocks
+
+        Memory of @b edges() => O(1) for @b cycle / @b complete / @b de_bruijn / @b torus ,
+                                O( V ) for @b union_of_cycles (the Hamilton cycle),
+                                O( V + E ) for @b random_multigraph (the stubs)
+ * @version 0.1
+ * @date 2022-10-28
+ *
+ * @copyright Copyright (c) 2022
+ *
+ */
+
+#pragma once
+
+#include "directed_graph.hpp"
+#include "generator.hpp"
+#include "sparse_graph.hpp"
+#include "undirected_graph.hpp"
+#include <algorithm>
+#include <charconv>
+#include <cstdint>
+#include <limits>
+#include <numeric>
+#include <ostream>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace Tool {
+
+struct WorkloadEdge {
+    std::uint32_t from = 0;
+    std::uint32_t to   = 0;
+};
+
+class EulerWorkload {
+public:
+    enum class Family : unsigned short {
+        cycle             = 0,
+        complete          = 1,
+        random_multigraph = 2,
+        de_bruijn         = 3,
+        torus             = 4,
+        union_of_cycles   = 5,
+    };
+
+    static constexpr size_t max_dense_nodes = size_t { 1 } << 14; // `to_graph` => at most 1 GiB of `int`
+
+private:
+    Family        Kind         = Family::cycle;
+    bool          Directed     = true;
+    size_t        NumOf_Nodes  = 0;
+    size_t        NumOf_Edges  = 0;
+    std::uint64_t Seed         = 0;
+    size_t        Alphabet     = 0; // de_bruijn
+    size_t        NumOf_Cols   = 0; // torus
+    size_t        MaxCycleSize = 0; // union_of_cycles
+
+    std::vector<std::uint32_t> Degrees; // random_multigraph , [vertex - 1]
+
+    /// @brief only its @b raw output is used => @b std::mt19937_64 is fully specified by the standard,
+    ///        but the @b distributions and @b std::shuffle are not (libstdc++ / libc++ / MSVC differ)
+    using engine_type = std::mt19937_64;
+
+    /// @brief uniform in [0, bound) , by @b modulo with @b rejection (no bias)
+    static std::uint64_t return_random_below(engine_type& engine, std::uint64_t bound) {
+        constexpr std::uint64_t max_value = std::numeric_limits<std::uint64_t>::max();
+        std::uint64_t           limit     = max_value - max_value % bound; // a multiple of `bound`
+        std::uint64_t           curr      = engine();
+        while (curr >= limit) {
+            curr = engine();
+        }
+        return curr % bound;
+    }
+    /// @brief uniform in [0, 1) , the top 53 bits
+    static double return_random_real(engine_type& engine) {
+        return static_cast<double>(engine() >> 11) * 0x1.0p-53;
+    }
+    /// @brief @b Fisher_Yates
+    static void shuffle(std::vector<std::uint32_t>& input, engine_type& engine) {
+        for (size_t index = input.size(); index > 1; --index) {
+            std::swap(input[index - 1], input[return_random_below(engine, index)]);
+        }
+    }
+
+    static void check_size(size_t num_of_nodes, size_t num_of_edges) {
+        constexpr size_t max_vertex = std::numeric_limits<std::uint32_t>::max();
+        if (num_of_nodes == 0) {
+            throw std::logic_error("num of vertex should >0. ");
+        }
+        if (num_of_nodes > max_vertex || num_of_edges > max_vertex) {
+            throw std::logic_error("The workload is too large, vertices and edges should fit in uint32. ");
+        }
+    }
+    /// @brief a random permutation of [1, n] , as the Hamilton cycle
+    static std::vector<std::uint32_t> return_random_order(size_t num_of_nodes, engine_type& engine) {
+        std::vector<std::uint32_t> res(num_of_nodes);
+        std::iota(res.begin(), res.end(), 1);
+        shuffle(res, engine);
+        return res;
+    }
+
+    Generator<WorkloadEdge> edges_of_random_multigraph() const {
+        engine_type engine(Seed + 1); // degrees are drawn by `Seed`
+        auto        order = return_random_order(NumOf_Nodes, engine);
+        for (size_t index = 0; index < NumOf_Nodes; ++index) {
+            co_yield WorkloadEdge { order[index], order[(index + 1) % NumOf_Nodes] };
+        }
+        // the cycle used 2 stubs ( @e directed => 1 out, 1 in ) of each vertex
+        size_t                     num_of_used = Directed ? 1 : 2;
+        std::vector<std::uint32_t> Stubs;
+        Stubs.reserve(Directed ? NumOf_Edges - NumOf_Nodes : 2 * (NumOf_Edges - NumOf_Nodes));
+        for (size_t vertex = 1; vertex <= NumOf_Nodes; ++vertex) {
+            Stubs.insert(Stubs.end(), Degrees[vertex - 1] - num_of_used, static_cast<std::uint32_t>(vertex));
+        }
+        shuffle(Stubs, engine);
+        if (Directed) {
+            // out stubs in vertex order, paired with shuffled in stubs
+            size_t index = 0;
+            for (size_t vertex = 1; vertex <= NumOf_Nodes; ++vertex) {
+                for (size_t rest = Degrees[vertex - 1] - 1; rest > 0; --rest, ++index) {
+                    co_yield WorkloadEdge { static_cast<std::uint32_t>(vertex), Stubs[index] };
+                }
+            }
+        } else {
+            for (size_t index = 0; index + 1 < Stubs.size(); index += 2) {
+                co_yield WorkloadEdge { Stubs[index], Stubs[index + 1] };
+            }
+        }
+    }
+    Generator<WorkloadEdge> edges_of_union_of_cycles() const {
+        engine_type engine(Seed);
+        auto        order = return_random_order(NumOf_Nodes, engine);
+        for (size_t index = 0; index < NumOf_Nodes; ++index) {
+            co_yield WorkloadEdge { order[index], order[(index + 1) % NumOf_Nodes] };
+        }
+        order = {};
+
+        size_t                     max_size = std::max<size_t>(MaxCycleSize, 2);
+        std::vector<std::uint32_t> cycle;
+        cycle.reserve(MaxCycleSize);
+        for (size_t rest = NumOf_Edges - NumOf_Nodes; rest > 0;) {
+            // `rest == 1` or `n == 1` => a self ring
+            size_t size = std::min({ 2 + return_random_below(engine, max_size - 1), rest, NumOf_Nodes });
+            if (rest - size == 1) { // never leave a single edge behind (it would be a self ring)
+                if (size < NumOf_Nodes) {
+                    ++size;
+                } else if (size > 2) {
+                    --size;
+                }
+            }
+            cycle.clear();
+            while (cycle.size() < size) {
+                auto vertex = static_cast<std::uint32_t>(1 + return_random_below(engine, NumOf_Nodes));
+                if (std::find(cycle.begin(), cycle.end(), vertex) == cycle.end()) {
+                    cycle.push_back(vertex);
+                }
+            }
+            for (size_t index = 0; index < size; ++index) {
+                co_yield WorkloadEdge { cycle[index], cycle[(index + 1) % size] };
+            }
+            rest -= size;
+        }
+    }
+    Generator<WorkloadEdge> edges_of_regular() const {
+        switch (Kind) {
+        case Family::cycle:
+            for (size_t vertex = 1; vertex <= NumOf_Nodes; ++vertex) {
+                co_yield WorkloadEdge {
+                    static_cast<std::uint32_t>(vertex),
+                    static_cast<std::uint32_t>(vertex % NumOf_Nodes + 1)
+                };
+            }
+            break;
+        case Family::complete:
+            for (size_t from = 1; from <= NumOf_Nodes; ++from) {
+                for (size_t to = Directed ? 1 : from + 1; to <= NumOf_Nodes; ++to) {
+                    if (from != to) {
+                        co_yield WorkloadEdge { static_cast<std::uint32_t>(from), static_cast<std::uint32_t>(to) };
+                    }
+                }
+            }
+            break;
+        case Family::de_bruijn:
+            for (size_t word = 0; word < NumOf_Nodes; ++word) {
+                for (size_t letter = 0; letter < Alphabet; ++letter) {
+                    co_yield WorkloadEdge {
+                        static_cast<std::uint32_t>(word + 1),
+                        static_cast<std::uint32_t>((word * Alphabet + letter) % NumOf_Nodes + 1)
+                    };
+                }
+            }
+            break;
+        default: { // torus
+            size_t num_of_rows = NumOf_Nodes / NumOf_Cols;
+            for (size_t row = 0; row < num_of_rows; ++row) {
+                for (size_t col = 0; col < NumOf_Cols; ++col) {
+                    auto vertex = static_cast<std::uint32_t>(row * NumOf_Cols + col + 1);
+                    co_yield WorkloadEdge {
+                        vertex,
+                        static_cast<std::uint32_t>(row * NumOf_Cols + (col + 1) % NumOf_Cols + 1)
+                    };
+                    co_yield WorkloadEdge {
+                        vertex,
+                        static_cast<std::uint32_t>((row + 1) % num_of_rows * NumOf_Cols + col + 1)
+                    };
+                }
+            }
+            break;
+        }
+        }
+    }
+
+public:
+    static EulerWorkload cycle(size_t num_of_nodes, bool directed = true) {
+        check_size(num_of_nodes, num_of_nodes);
+        EulerWorkload res;
+        res.Kind        = Family::cycle;
+        res.Directed    = directed;
+        res.NumOf_Nodes = num_of_nodes;
+        res.NumOf_Edges = num_of_nodes;
+        return res;
+    }
+    /// @exception std::logic_error if @e undirected and `num_of_nodes` is even (=> odd degrees)
+    static EulerWorkload complete(size_t num_of_nodes, bool directed = true) {
+        check_size(num_of_nodes, num_of_nodes * (num_of_nodes - 1));
+        if (!directed && num_of_nodes % 2 == 0) {
+            throw std::logic_error("An undirected complete graph needs an odd num of vertex to be eulerian. ");
+        }
+        EulerWorkload res;
+        res.Kind        = Family::complete;
+        res.Directed    = directed;
+        res.NumOf_Nodes = num_of_nodes;
+        res.NumOf_Edges = directed ? num_of_nodes * (num_of_nodes - 1) : num_of_nodes * (num_of_nodes - 1) / 2;
+        return res;
+    }
+    /**
+     * @param degree_weights weights[d] => relative chance of degree `d` (all >= 0, at least one > 0)
+     * @note the degrees are drawn @b here , the edges are drawn again by @b edges()
+     */
+    static EulerWorkload random_multigraph(
+        size_t                     num_of_nodes,
+        const std::vector<double>& degree_weights,
+        bool                       directed,
+        std::uint64_t              seed
+    ) {
+        check_size(num_of_nodes, 0);
+        if (std::none_of(degree_weights.begin(), degree_weights.end(), [](double weight) { return weight > 0; })) {
+            throw std::logic_error("degree_weights should have a positive weight. ");
+        }
+        if (std::any_of(degree_weights.begin(), degree_weights.end(), [](double weight) { return weight < 0; })) {
+            throw std::logic_error("degree_weights should be >=0. ");
+        }
+        EulerWorkload res;
+        res.Kind        = Family::random_multigraph;
+        res.Directed    = directed;
+        res.NumOf_Nodes = num_of_nodes;
+        res.Seed        = seed;
+
+        engine_type         engine(seed);
+        std::vector<double> partial_sums(degree_weights.size()); // weights[0] + ... + weights[d]
+        std::partial_sum(degree_weights.begin(), degree_weights.end(), partial_sums.begin());
+        auto random_degree = [&engine, &partial_sums] {
+            double target = return_random_real(engine) * partial_sums.back();
+            auto   iter   = std::upper_bound(partial_sums.begin(), partial_sums.end(), target);
+            return static_cast<size_t>(std::min(iter, partial_sums.end() - 1) - partial_sums.begin());
+        };
+        res.Degrees.resize(num_of_nodes);
+        size_t sum = 0;
+        for (auto&& degree : res.Degrees) {
+            size_t drawn = random_degree();
+            degree       = static_cast<std::uint32_t>(directed ? std::max<size_t>(drawn, 1) : std::max<size_t>(drawn + drawn % 2, 2));
+            sum += degree;
+        }
+        res.NumOf_Edges = directed ? sum : sum / 2;
+        check_size(num_of_nodes, res.NumOf_Edges);
+        return res;
+    }
+    /// @brief B(alphabet, word_length) => alphabet ^ word_length vertices, alphabet ^ (word_length + 1) edges
+    static EulerWorkload de_bruijn(size_t alphabet, size_t word_length, bool directed = true) {
+        if (alphabet < 2 || word_length == 0) {
+            throw std::logic_error("de Bruijn graph needs alphabet >= 2 and word_length >= 1. ");
+        }
+        size_t num_of_nodes = 1;
+        for (size_t index = 0; index < word_length; ++index) {
+            if (num_of_nodes > std::numeric_limits<std::uint32_t>::max() / alphabet) {
+                throw std::logic_error("The workload is too large, vertices and edges should fit in uint32. ");
+            }
+            num_of_nodes *= alphabet;
+        }
+        check_size(num_of_nodes, num_of_nodes * alphabet);
+        EulerWorkload res;
+        res.Kind        = Family::de_bruijn;
+        res.Directed    = directed;
+        res.NumOf_Nodes = num_of_nodes;
+        res.NumOf_Edges = num_of_nodes * alphabet;
+        res.Alphabet    = alphabet;
+        return res;
+    }
+    static EulerWorkload torus(size_t num_of_rows, size_t num_of_cols, bool directed = false) {
+        check_size(num_of_rows * num_of_cols, 2 * num_of_rows * num_of_cols);
+        EulerWorkload res;
+        res.Kind        = Family::torus;
+        res.Directed    = directed;
+        res.NumOf_Nodes = num_of_rows * num_of_cols;
+        res.NumOf_Edges = 2 * res.NumOf_Nodes;
+        res.NumOf_Cols  = num_of_cols;
+        return res;
+    }
+    /// @param num_of_edges should >= `num_of_nodes` (the Hamilton cycle)
+    static EulerWorkload union_of_cycles(
+        size_t        num_of_nodes,
+        size_t        num_of_edges,
+        std::uint64_t seed,
+        size_t        max_cycle_length = 8,
+        bool          directed         = true
+    ) {
+        check_size(num_of_nodes, num_of_edges);
+        if (num_of_edges < num_of_nodes) {
+            throw std::logic_error("num of edges should >= num of vertex (a Hamilton cycle comes first). ");
+        }
+        EulerWorkload res;
+        res.Kind         = Family::union_of_cycles;
+        res.Directed     = directed;
+        res.NumOf_Nodes  = num_of_nodes;
+        res.NumOf_Edges  = num_of_edges;
+        res.Seed         = seed;
+        res.MaxCycleSize = max_cycle_length;
+        return res;
+    }
+
+    Family return_family() const {
+        return Kind;
+    }
+    bool if_directed() const {
+        return Directed;
+    }
+    size_t return_num_of_nodes() const {
+        return NumOf_Nodes;
+    }
+    size_t return_num_of_edges() const {
+        return NumOf_Edges;
+    }
+
+    /// @brief all edges, @b exactly `return_num_of_edges()` , the same ones each call
+    /// @attention the generator refers to @b this , don't let it outlive the workload
+    Generator<WorkloadEdge> edges() const {
+        switch (Kind) {
+        case Family::random_multigraph:
+            return edges_of_random_multigraph();
+        case Family::union_of_cycles:
+            return edges_of_union_of_cycles();
+        default:
+            return edges_of_regular();
+        }
+    }
+    /// @brief { from, to, 1 } * num_of_edges
+    std::vector<std::uint32_t> return_edge_list() const {
+        std::vector<std::uint32_t> res;
+        res.reserve(3 * NumOf_Edges);
+        for (auto&& edge : edges()) {
+            res.push_back(edge.from), res.push_back(edge.to), res.push_back(1);
+        }
+        return res;
+    }
+    template <bool D>
+    SparseGraph<D> to_sparse_graph() const {
+        if (D != Directed) {
+            throw std::logic_error(Directed ? "The workload is directed. " : "The workload is undirected. ");
+        }
+        return SparseGraph<D>::build(NumOf_Nodes, return_edge_list());
+    }
+    /// @exception std::logic_error if the matrix would be larger than `max_dense_nodes` ^ 2
+    template <bool D>
+    Graph<D> to_graph() const {
+        if (D != Directed) {
+            throw std::logic_error(Directed ? "The workload is directed. " : "The workload is undirected. ");
+        }
+        if (NumOf_Nodes > max_dense_nodes) {
+            throw std::logic_error(
+                "The workload is too large for an Adjacency Matrix ( > "
+                + std::to_string(max_dense_nodes) + " vertices), try `to_sparse_graph`. "
+            );
+        }
+        Matrix<int>::rows_type initMat(NumOf_Nodes, Matrix<int>::row_type(NumOf_Nodes, 0));
+        for (auto&& [from, to] : edges()) {
+            if (D) {
+                ++initMat[from - 1][to - 1];
+            } else if (from == to) {
+                initMat[from - 1][to - 1] += 2; // self ring is stored as `2`
+            } else {
+                ++initMat[from - 1][to - 1];
+                ++initMat[to - 1][from - 1];
+            }
+        }
+        return Graph<D>(std::move(initMat));
+    }
+
+    /// @brief "n m directed" , then "u v" per line
+    void write_text(std::ostream& output) const {
+        constexpr size_t max_digits = std::numeric_limits<std::uint64_t>::digits10 + 1;
+        constexpr size_t block_size = size_t { 1 } << 16;
+
+        std::string buffer;
+        buffer.reserve(block_size + 2 * max_digits + 2);
+        auto append = [&buffer](std::uint64_t value, char separator) {
+            char digits[max_digits];
+            auto [end, error] = std::to_chars(digits, digits + max_digits, value);
+            buffer.append(digits, end);
+            buffer += separator;
+        };
+        append(NumOf_Nodes, ' ');
+        append(NumOf_Edges, ' ');
+        append(Directed, '\n');
+        for (auto&& [from, to] : edges()) {
+            append(from, ' ');
+            append(to, '\n');
+            if (buffer.size() >= block_size) {
+                output.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+                buffer.clear();
+            }
+        }
+        output.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+    }
+    /// @brief @b uint32 , @p native_byte_order => n, m, directed, then { u, v, 1 } * m
+    void write_binary(std::ostream& output) const {
+        constexpr size_t block_size = size_t { 1 } << 14; // values
+
+        std::vector<std::uint32_t> buffer;
+        buffer.reserve(block_size + 3);
+        auto write_buffer = [&output, &buffer] {
+            output.write(
+                reinterpret_cast<const char*>(buffer.data()),
+                static_cast<std::streamsize>(buffer.size() * sizeof(std::uint32_t))
+            );
+            buffer.clear();
+        };
+        buffer.push_back(static_cast<std::uint32_t>(NumOf_Nodes));
+        buffer.push_back(static_cast<std::uint32_t>(NumOf_Edges));
+        buffer.push_back(Directed ? 1 : 0);
+        for (auto&& [from, to] : edges()) {
+            buffer.push_back(from), buffer.push_back(to), buffer.push_back(1);
+            if (buffer.size() >= block_size) {
+                write_buffer();
+            }
+        }
+        write_buffer();
+    }
+};
+
+} // namespace Tool
@@ -11,31 +11,70 @@
 
 #pragma once
 #include "Matrix.hpp"
+#include "euler_result.hpp"
+#include "graph_view.hpp"
+#include "hot_path_counters.hpp"
+#include "memory_tracking.hpp"
+#include "trace_events.hpp"
+#include <algorithm>
+#include <stack>
 #include <stdexcept>
 #include <unordered_set>
 #include <utility>
+#include <vector>
 
 namespace Tool {
 
+/**
+ * @brief result of the @b strongly_connected_components decomposition
+ * @note
+        @b vertex and @b component are both @p start_from_`1`
+        @b components are numbered in @e topological_order of the @b condensation ,
+            that means every edge in @b condensation goes from a smaller id to a larger one
+ */
+struct StronglyConnectedComponents {
+    size_t num_of_components = 0;
+
+    /// @brief component_of[vertex - 1] => component id of `vertex`
+    std::vector<size_t> component_of;
+
+    /// @brief condensation[component - 1] => sorted successors, without duplicates
+    std::vector<std::vector<size_t>> condensation;
+};
+
 class GeneralGraphToolSet {
 protected:
     GeneralGraphToolSet() = default;
 
     /// @brief @b connectivity
+    /// @note @b boolean powers => `A` and each power are clamped to `0` / `1` ,
+    ///       so no element of the sum goes over `n` (a power of a dense graph would overflow `int` )
     static bool if_connective(Tool::Matrix<int> inputDataMat) {
-        auto num_of_nodes = inputDataMat.get_sizeof_row();
+        HotPathCounters::add(HotPathCounter::connectivity_checks);
+        auto num_of_nodes  = inputDataMat.get_sizeof_row();
+        auto clamp_to_bool = [num_of_nodes](Tool::Matrix<int>& input) {
+            for (size_t row = 1; row <= num_of_nodes; ++row) {
+                for (size_t col = 1; col <= num_of_nodes; ++col) {
+                    input(row, col) = input(row, col) != 0;
+                }
+            }
+        };
+        clamp_to_bool(inputDataMat);
         auto final
-            = Tool::Matrix<int>::CreateZeroMat(
+            = Tool::Matrix<int>::CreateIdentityMat(
                 num_of_nodes,
                 num_of_nodes
             );
+        auto powered = final;
 
-        for (size_t pow_num = 0; // A^0 + A^1 + A^2 + ... + A^(n-1)
+        for (size_t pow_num = 1; // A^0 + A^1 + A^2 + ... + A^(n-1)
              pow_num < num_of_nodes;
              ++pow_num) {
-            auto powered = inputDataMat ^ pow_num;
-            auto added   = final + powered;
-            final        = added;
+            auto next = powered * inputDataMat;
+            clamp_to_bool(next);
+            powered    = next;
+            auto added = final + powered;
+            final      = added;
         }
 
         if (final.if_have_zero_integer(final)) {
@@ -47,6 +86,7 @@ protected:
         Tool::Matrix<int>&          inputDataMat,
         std::unordered_set<size_t>& ignore_v_set // default => empty list
     ) {
+        HotPathCounters::add(HotPathCounter::partial_connectivity_checks);
         if (ignore_v_set.empty()) {
             return if_connective(inputDataMat);
         }
@@ -57,8 +97,8 @@ protected:
         size_t& MatRow  = MatSize;
         size_t& MatCol  = MatSize;
 
-        std::vector<std::vector<int>> new_init_list;
-        std::vector<int>              new_init_row;
+        Tool::Matrix<int>::rows_type new_init_list;
+        Tool::Matrix<int>::row_type  new_init_row;
         new_init_list.reserve(MatSize);
         new_init_row.reserve(MatSize);
         for (size_t row = 1; row <= MatRow; ++row) {
@@ -76,12 +116,444 @@ protected:
             new_init_row.clear();
         }
 
-        Tool::Matrix<int> new_data_mat(new_init_list);
+        Tool::Matrix<int> new_data_mat(std::move(new_init_list));
         res = if_connective(new_data_mat);
 
         return res;
     }
 
+    /**
+     * @brief @b Tarjan_algorithm , but @p iterative
+     * @note
+            An explicit frame stack replaces the recursion, so there's no
+            @b recursion_depth_limit even for graphs with millions of vertices.
+            Works on any @b GraphView , for an @e undirected one it gives the
+            @b connected_components .
+
+            T(n) = O( V + E ) iterations (dense backend => O( V * V / 64 + E ) )
+
+     * @param graph
+     * @return StronglyConnectedComponents
+     */
+    template <GraphView G>
+    static StronglyConnectedComponents return_strongly_connected_components(
+        G& graph
+    ) {
+        constexpr size_t unvisited = 0;
+
+        size_t num_of_nodes = graph.return_num_of_nodes();
+
+        std::vector<size_t> index_of(num_of_nodes + 1, unvisited); // discover order, start from `1`
+        std::vector<size_t> low_of(num_of_nodes + 1, 0);
+        std::vector<bool>   if_on_stack(num_of_nodes + 1, false);
+        std::vector<size_t> finished_order(num_of_nodes + 1, 0); // reverse topological id
+
+        std::vector<size_t> tarjan_stack;
+        tarjan_stack.reserve(num_of_nodes);
+
+        /// @brief frame => { vertex, last scanned col (`0` => haven't scanned) }
+        std::vector<std::pair<size_t, size_t>> frames;
+        frames.reserve(num_of_nodes);
+
+        size_t next_index      = 1;
+        size_t num_of_finished = 0;
+        auto   discover_vertex = [&](size_t vertex) {
+            index_of[vertex] = next_index;
+            low_of[vertex]   = next_index;
+            ++next_index;
+            tarjan_stack.push_back(vertex);
+            if_on_stack[vertex] = true;
+            frames.emplace_back(vertex, 0);
+        };
+
+        for (size_t root = 1; root <= num_of_nodes; ++root) {
+            if (index_of[root] != unvisited) {
+                continue;
+            }
+            discover_vertex(root);
+            while (!frames.empty()) {
+                auto& [curr_vertex, scanned_col] = frames.back();
+                size_t next_vertex
+                    = scanned_col == 0
+                    ? graph.return_first_iterable(curr_vertex)
+                    : graph.return_next_iterable(curr_vertex, scanned_col);
+
+                if (next_vertex != 0) {
+                    scanned_col = next_vertex;
+                    if (index_of[next_vertex] == unvisited) {
+                        discover_vertex(next_vertex); // `curr_vertex` is invalid from now on
+                    } else if (if_on_stack[next_vertex]) {
+                        low_of[curr_vertex] = std::min(low_of[curr_vertex], index_of[next_vertex]);
+                    }
+                    continue;
+                }
+
+                // all neighbors scanned => pop the frame
+                size_t finished_vertex = curr_vertex;
+                frames.pop_back();
+                if (!frames.empty()) {
+                    size_t parent  = frames.back().first;
+                    low_of[parent] = std::min(low_of[parent], low_of[finished_vertex]);
+                }
+                if (low_of[finished_vertex] != index_of[finished_vertex]) {
+                    continue;
+                }
+                // `finished_vertex` is the root of a component
+                ++num_of_finished;
+                while (true) {
+                    size_t member = tarjan_stack.back();
+                    tarjan_stack.pop_back();
+                    if_on_stack[member]    = false;
+                    finished_order[member] = num_of_finished;
+                    if (member == finished_vertex) {
+                        break;
+                    }
+                }
+            }
+        }
+
+        StronglyConnectedComponents res;
+        res.num_of_components = num_of_finished;
+        res.component_of.reserve(num_of_nodes);
+        for (size_t vertex = 1; vertex <= num_of_nodes; ++vertex) {
+            // tarjan finishes sink components first, so reverse it to get topological order
+            res.component_of.emplace_back(num_of_finished + 1 - finished_order[vertex]);
+        }
+
+        res.condensation.resize(num_of_finished);
+        for (size_t vertex = 1; vertex <= num_of_nodes; ++vertex) {
+            size_t from = res.component_of[vertex - 1];
+            for (size_t col = graph.return_first_iterable(vertex);
+                 col != 0;
+                 col = graph.return_next_iterable(vertex, col)) {
+                size_t to = res.component_of[col - 1];
+                if (from != to) {
+                    res.condensation[from - 1].emplace_back(to);
+                }
+            }
+        }
+        for (auto&& successors : res.condensation) {
+            std::sort(successors.begin(), successors.end());
+            successors.erase(
+                std::unique(successors.begin(), successors.end()),
+                successors.end()
+            );
+        }
+
+        return res;
+    }
+
+    /**
+     * @brief @b bridges of an @e undirected graph, by @p iterative @b lowlink (like Tarjan above)
+     * @note
+            @b multi_edges are never bridges (the other one is a @b back_edge ),
+            @b self_rings are ignored.
+
+            T(n) = O( V + E ) iterations
+     * @return sorted { smaller vertex, larger vertex }
+     */
+    template <GraphView G>
+        requires(!G::if_directed)
+    static std::vector<std::pair<size_t, size_t>> return_bridges(G& graph) {
+        constexpr size_t unvisited = 0;
+
+        size_t num_of_nodes = graph.return_num_of_nodes();
+
+        std::vector<size_t> index_of(num_of_nodes + 1, unvisited);
+        std::vector<size_t> low_of(num_of_nodes + 1, 0);
+
+        /// @brief frame => { vertex, parent, last scanned col }
+        struct Frame {
+            size_t vertex;
+            size_t parent;
+            size_t scanned_col;
+        };
+        std::vector<Frame> frames;
+        frames.reserve(num_of_nodes);
+
+        std::vector<std::pair<size_t, size_t>> res;
+
+        size_t next_index = 1;
+        for (size_t root = 1; root <= num_of_nodes; ++root) {
+            if (index_of[root] != unvisited) {
+                continue;
+            }
+            index_of[root] = low_of[root] = next_index++;
+            frames.push_back({ root, 0, 0 });
+            while (!frames.empty()) {
+                auto& [curr_vertex, parent, scanned_col] = frames.back();
+                size_t next_vertex
+                    = scanned_col == 0
+                    ? graph.return_first_iterable(curr_vertex)
+                    : graph.return_next_iterable(curr_vertex, scanned_col);
+
+                if (next_vertex != 0) {
+                    scanned_col = next_vertex;
+                    if (next_vertex == curr_vertex) {
+                        continue; // self ring
+                    }
+                    if (next_vertex == parent) {
+                        // the tree edge itself doesn't count, but its parallel ones do
+                        if (graph.return_multiplicity(curr_vertex, parent) > 1) {
+                            low_of[curr_vertex] = std::min(low_of[curr_vertex], index_of[parent]);
+                        }
+                        continue;
+                    }
+                    if (index_of[next_vertex] == unvisited) {
+                        index_of[next_vertex] = low_of[next_vertex] = next_index++;
+                        frames.push_back({ next_vertex, curr_vertex, 0 }); // frame refs are invalid now
+                    } else {
+                        low_of[curr_vertex] = std::min(low_of[curr_vertex], index_of[next_vertex]);
+                    }
+                    continue;
+                }
+
+                // all neighbors scanned => pop the frame
+                size_t finished_vertex = curr_vertex;
+                size_t finished_parent = parent;
+                frames.pop_back();
+                if (finished_parent == 0) {
+                    continue;
+                }
+                low_of[finished_parent] = std::min(low_of[finished_parent], low_of[finished_vertex]);
+                if (low_of[finished_vertex] > index_of[finished_parent]) {
+                    res.emplace_back(
+                        std::min(finished_vertex, finished_parent),
+                        std::max(finished_vertex, finished_parent)
+                    );
+                }
+            }
+        }
+
+        std::sort(res.begin(), res.end());
+        return res;
+    }
+
+    static StronglyConnectedComponents return_strongly_connected_components(
+        Tool::Matrix<int>& inputDataMat
+    ) {
+        Tool::DenseGraphView<true> inputView(inputDataMat);
+        return return_strongly_connected_components(inputView);
+    }
+
+    /// @brief @b connectivity (strong connectivity if directed), on a @b GraphView
+    template <GraphView G>
+    static bool if_connective(G& graph) {
+        TraceSpan span("connectivity", "connectivity");
+        HotPathCounters::add(HotPathCounter::connectivity_checks);
+        return return_strongly_connected_components(graph).num_of_components == 1;
+    }
+
+    /// @brief degrees on a @b GraphView
+
+    template <GraphView G>
+    static constexpr size_t return_degree(G& graph, size_t vertex) {
+        if constexpr (G::if_directed) {
+            return graph.return_in_degree(vertex) + graph.return_out_degree(vertex);
+        } else {
+            return graph.return_out_degree(vertex);
+        }
+    }
+    template <GraphView G>
+    static constexpr bool if_trivial(G& graph) {
+        return graph.return_num_of_nodes() == 1
+            && graph.return_multiplicity(1, 1) == 0;
+    }
+    /**
+     * @brief judge if has a euler circle
+     * @note
+            @e directed   => in_deg == out_deg for each vertex, and strongly connective
+            @e undirected => deg is even for each vertex, and connective
+     */
+    template <GraphView G>
+    static bool if_has_euler_circle(G& graph) {
+        if (if_trivial(graph)) {
+            return true;
+        }
+        size_t num_of_node = graph.return_num_of_nodes();
+        {
+            TraceSpan span("check_degrees", "degree");
+            for (size_t curr_vertex = 1; curr_vertex <= num_of_node; ++curr_vertex) {
+                if constexpr (G::if_directed) {
+                    if (graph.return_in_degree(curr_vertex)
+                        != graph.return_out_degree(curr_vertex)) {
+                        return false;
+                    }
+                } else {
+                    if (graph.return_out_degree(curr_vertex) % 2 != 0) {
+                        return false;
+                    }
+                }
+            }
+        }
+        return if_connective(graph);
+    }
+
+    /// @brief euler circle on a @b GraphView ( @p edges_will_be_cut => pass a view of a copy )
+
+    /// @brief Hierholzer Algorithm, T(n)=O(n), fastest
+    /// @ref https://www.jianshu.com/p/8394b8e5b878
+    /// @attention this is a reference, not the original work of me!
+    template <GraphView G>
+    static EulerResult
+    return_an_euler_circle_H_fastest(G& graph, size_t vertex) {
+        if (!if_has_euler_circle(graph)) {
+            return EulerResult::no_euler_circle();
+        }
+        if (if_trivial(graph)) {
+            return EulerResult::trivial(vertex);
+        }
+        return walk_an_euler_circle_H_fastest(graph, vertex);
+    }
+    /// @attention @b no_check => the graph @p must_have an euler circle, and @p must_not be trivial
+    template <GraphView G>
+    static EulerResult
+    walk_an_euler_circle_H_fastest(G& graph, size_t vertex) {
+        TraceSpan                                 span("hierholzer_fastest", "construction");
+        std::stack<size_t, TrackedVector<size_t>> path;
+
+        EulerResult res;
+        res.stats.num_of_edges = graph.return_num_of_edges();
+        res.vertices.reserve(res.stats.num_of_edges + 1);
+
+        size_t curr_vertex = vertex;
+        path.push(curr_vertex);
+        while (!path.empty()) {
+            // walking in a balanced graph => (out_deg == 0) <=> (in_deg + out_deg == 0)
+            if (graph.return_out_degree(curr_vertex) != 0) {
+                // curr_vertex is not alone
+                // we haven't found the ring
+                path.push(curr_vertex);
+                size_t next_vertex = graph.return_first_iterable(curr_vertex);
+                graph.cut_an_edge_of(curr_vertex, next_vertex);
+                curr_vertex = next_vertex;
+                ++res.stats.num_of_steps;
+            } else {
+                // curr_vertex is alone
+                // that means we've found a ring
+                res.vertices.push_back(curr_vertex);
+                curr_vertex = path.top();
+                path.pop();
+                ++res.stats.num_of_backtracks;
+            }
+        };
+
+        HotPathCounters::add(HotPathCounter::traversal_steps, res.stats.num_of_steps);
+
+        // vertices are found in the reversed order
+        std::reverse(res.vertices.begin(), res.vertices.end());
+        res.status = EulerStatus::found;
+
+        return res;
+    }
+
+    /// @brief Hierholzer Algorithm, T(n)=O(n)
+    /// @brief This one may be slower, but it's easier to comprehend
+    /// @e This_one_is_totally_originally_written_by_me
+    /// @e Hierholzer_Algorithm_YYDS
+    /// @attention @b known_invalid on multigraphs (and some simple graphs, e.g. an undirected torus) =>
+    ///            use @b H_linear / @b H_fastest where the circle matters
+    template <GraphView G>
+    static EulerResult
+    return_an_euler_circle_H(G& graph, size_t vertex) {
+        if (!if_has_euler_circle(graph)) {
+            return EulerResult::no_euler_circle();
+        }
+        if (if_trivial(graph)) {
+            return EulerResult::trivial(vertex);
+        }
+        return walk_an_euler_circle_H(graph, vertex);
+    }
+    /// @attention @b no_check => the graph @p must_have an euler circle, and @p must_not be trivial
+    template <GraphView G>
+    static EulerResult
+    walk_an_euler_circle_H(G& graph, size_t vertex) {
+        TraceSpan                                 span("hierholzer", "construction");
+        std::stack<size_t, TrackedVector<size_t>> path;
+
+        EulerResult res;
+        res.stats.num_of_edges = graph.return_num_of_edges();
+
+        size_t curr_vertex   = vertex;
+        size_t curr_edge_sum = graph.return_num_of_edges();
+
+        /**
+         * @param if_compensate
+         * @brief
+                If you've stepped into an @b alone_node , while you still haven't pass
+                all edges, then you need to compensate the latest-deleted edge.
+
+                But, you shouldn't compensate immediately, because
+                after you backtraced to @e get @b vertex_nearest_the_alone_one ,
+                you hate to relate @b it to the @b previous_alone_node
+                |
+                |
+                |-> @brief this phenomenon is definite, because you have @b already
+                    linked to that @b alone_node , which shows that the
+                    @p index_of_that_alone_node is smaller than any other node linked to
+                    @b vertex_nearest_the_alone_one (smaller_index node always get linked first)
+
+                You should compensate after @e linking @b vertex_nearest_the_alone_one
+                with @b the_vertex_next_to_alone_one
+         */
+        bool if_compensate = false;
+
+        size_t compensated_vertex = curr_vertex; // only as default value
+        size_t compensated_col    = 1;           // only as default value
+
+        while (curr_edge_sum > 0) {
+            if (return_degree(graph, curr_vertex) > 0) {
+                // curr_vertex can reach other vertex
+                // we haven't found the ring
+                path.push(curr_vertex);
+                size_t next_vertex = graph.return_first_iterable(curr_vertex);
+                graph.cut_an_edge_of(curr_vertex, next_vertex);
+                compensated_vertex = curr_vertex;
+                compensated_col    = next_vertex;
+                curr_vertex        = next_vertex;
+                ++res.stats.num_of_steps;
+                // update sum_of_edge
+                --curr_edge_sum;
+                if (if_compensate) {
+                    // relink the edge
+                    graph.add_an_edge_of(compensated_vertex, compensated_col);
+                    // compensate sum_of_edge
+                    ++curr_edge_sum;
+                    // reset the compensate flag
+                    if_compensate = false;
+                }
+            } else {
+                // curr_vertex cannot reach another vertex
+                // that means we've found a ring
+                curr_vertex = path.top();
+                path.pop(); // because it will be pushed into it again!
+                if_compensate = true;
+                ++res.stats.num_of_backtracks;
+            }
+        }
+        HotPathCounters::add(HotPathCounter::traversal_steps, res.stats.num_of_steps);
+
+        res.vertices.reserve(path.size() + 1);
+        while (!path.empty()) {
+            res.vertices.push_back(path.top());
+            path.pop();
+        }
+        std::reverse(res.vertices.begin(), res.vertices.end());
+
+        /**
+         * @brief
+                the last vertex is the start vertex
+                but when you try to push it into the stack in the `while` loop,
+                you'll find it's impossible because `edge == 0` and you can't get in
+                so you have to add it manually
+         * @param res
+         */
+        res.vertices.push_back(vertex);
+        res.status = EulerStatus::found;
+
+        return res;
+    }
+
     /// @brief methods about iterating of vertex and edge
 
     /**
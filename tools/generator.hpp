@@ -0,0 +1,129 @@
+/**
+ * @file generator.hpp
+ * @author Eden (edwardwang33773@gmail.com)
+ * @brief A minimal @b lazy generator on C++20 coroutines ( @e std::generator is not shipped everywhere yet)
+ * @note
+        `co_yield value` => suspends, the consumer reads it through @b begin() / @b operator++ ,
+        and the coroutine @b only resumes when the consumer asks for the next one.
+
+        So the consumer could @b stop_early (break, or just drop the generator),
+        and the rest is @p never_computed , the coroutine frame is freed by the destructor.
+
+        A yielded value is @b referenced , @p not_copied => it's valid until the next @b operator++ .
+ * @version 0.1
+ * @date 2022-10-26
+ *
+ * @copyright Copyright (c) 2022
+ *
+ */
+
+#pragma once
+
+#include <coroutine>
+#include <exception>
+#include <iterator>
+#include <memory>
+#include <utility>
+
+namespace Tool {
+
+template <typename T>
+class Generator {
+public:
+    struct promise_type {
+        const T*           Value = nullptr;
+        std::exception_ptr Exception;
+
+        Generator get_return_object() {
+            return Generator { std::coroutine_handle<promise_type>::from_promise(*this) };
+        }
+        std::suspend_always initial_suspend() noexcept {
+            return {};
+        }
+        std::suspend_always final_suspend() noexcept {
+            return {};
+        }
+        std::suspend_always yield_value(const T& value) noexcept {
+            Value = std::addressof(value);
+            return {};
+        }
+        void return_void() noexcept { }
+        void unhandled_exception() {
+            Exception = std::current_exception();
+        }
+        void await_transform() = delete; // no `co_await` in a generator
+    };
+
+    class iterator {
+        std::coroutine_handle<promise_type> Handle = nullptr;
+
+        void resume_or_throw() {
+            Handle.resume();
+            if (Handle.done() && Handle.promise().Exception) {
+                std::rethrow_exception(Handle.promise().Exception);
+            }
+        }
+
+    public:
+        using value_type      = T;
+        using difference_type = std::ptrdiff_t;
+
+        iterator() = default;
+        explicit iterator(std::coroutine_handle<promise_type> handle)
+            : Handle(handle) {
+            resume_or_throw();
+        }
+
+        const T& operator*() const {
+            return *(Handle.promise().Value);
+        }
+        const T* operator->() const {
+            return Handle.promise().Value;
+        }
+        iterator& operator++() {
+            resume_or_throw();
+            return *this;
+        }
+        void operator++(int) {
+            ++*this;
+        }
+        friend bool operator==(const iterator& lhs, std::default_sentinel_t) {
+            return !lhs.Handle || lhs.Handle.done();
+        }
+    };
+
+    Generator() = default;
+    explicit Generator(std::coroutine_handle<promise_type> handle)
+        : Handle(handle) { }
+    Generator(const Generator&)            = delete;
+    Generator& operator=(const Generator&) = delete;
+    Generator(Generator&& other) noexcept
+        : Handle(std::exchange(other.Handle, nullptr)) { }
+    Generator& operator=(Generator&& other) noexcept {
+        if (this != &other) {
+            if (Handle) {
+                Handle.destroy();
+            }
+            Handle = std::exchange(other.Handle, nullptr);
+        }
+        return *this;
+    }
+    ~Generator() {
+        if (Handle) {
+            Handle.destroy();
+        }
+    }
+
+    /// @attention call it @b once , the generator is @b single_pass
+    iterator begin() {
+        return Handle ? iterator { Handle } : iterator {};
+    }
+    std::default_sentinel_t end() {
+        return {};
+    }
+
+private:
+    std::coroutine_handle<promise_type> Handle = nullptr;
+};
+
+} // namespace Tool
@@ -0,0 +1,890 @@
+/**
+ * @file graph.hpp
+ * @author Eden (edwardwang33773@gmail.com)
+ * @brief Graph<Directed>, ( @b directed_graph / @b undirected_graph )
+ * @note
+        @b Directed is resolved at @p compile_time , everything different between
+        @e directed_graph and @e undirected_graph ( @b edge_cut / @b edge_add ,
+        @b degree , @b validation ) is specialized by `if constexpr`,
+        so there's @p no_runtime_branch on the type of graph.
+ * @version 0.2
+ * @date 2022-10-22
+ *
+ * @copyright Copyright (c) 2022
+ *
+ */
+
+#pragma once
+
+#include "Matrix.hpp"
+#include "euler_circle_counter.hpp"
+#include "euler_circle_enumerator.hpp"
+#include "euler_circle_set.hpp"
+#include "euler_result.hpp"
+#include "general_graph_tool_set.hpp"
+#include "graph_property_cache.hpp"
+#include "graph_view.hpp"
+#include "linear_hierholzer.hpp"
+#include "memory_tracking.hpp"
+#include "parallel_hierholzer.hpp"
+#include "thread_pool.hpp"
+#include "trace_events.hpp"
+#include <algorithm>
+#include <cstdint>
+#include <optional>
+#include <stack>
+#include <stdexcept>
+#include <string>
+#include <unordered_set>
+#include <utility>
+
+using intMat = Tool::Matrix<int>;
+
+template <bool Directed>
+class Graph;
+
+using directed_graph   = Graph<true>;
+using undirected_graph = Graph<false>;
+using graph            = directed_graph;
+
+template <bool Directed>
+class Graph : public Tool::GeneralGraphToolSet {
+public:
+    static constexpr bool if_directed = Directed;
+
+    using view_type = Tool::DenseGraphView<Directed>;
+
+private:
+    intMat* DataMat = nullptr; // unsafe pointer, owned
+
+    size_t                   Version = 0; // bumped by every edit
+    Tool::GraphPropertyCache Cache;       // derived properties, see @b return_cache()
+
+    /// @brief the cache, dropped if the graph has been edited since it was filled
+    Tool::GraphPropertyCache& return_cache() {
+        Cache.sync(Version);
+        return Cache;
+    }
+    void fill_degrees() {
+        Tool::GraphPropertyCache& cache = return_cache();
+        if (cache.out_degree) {
+            return;
+        }
+        size_t num_of_nodes = DataMat->get_sizeof_row();
+        cache.out_degree.emplace(num_of_nodes, 0);
+        cache.in_degree.emplace(num_of_nodes, 0);
+        for (size_t row = 1; row <= num_of_nodes; ++row) {
+            for (size_t col = 1; col <= num_of_nodes; ++col) {
+                (*cache.out_degree)[row - 1] += (*DataMat)(row, col);
+                (*cache.in_degree)[col - 1] += (*DataMat)(row, col);
+            }
+        }
+    }
+
+    constexpr bool check_DataMat(intMat* DataMat) {
+        return DataMat->get_sizeof_row() == DataMat->get_sizeof_col();
+    }
+    bool if_symmetric_of_main_diagonal() {
+        return Tool::Matrix<int>::if_symmetric_of_main_diagonal(*DataMat);
+    }
+    bool check_self_ring() {
+        intMat& This_DataMat = *DataMat; // this is bind, not init
+        size_t  row          = This_DataMat.get_sizeof_row();
+
+        for (size_t curr_row = 1; curr_row <= row; ++curr_row) {
+            if (This_DataMat(curr_row, curr_row) % 2 != 0) {
+                return false;
+            }
+        }
+        return true;
+    }
+    /// @brief validate the @b DataMat , delete it and throw if it's illegal
+    void check_or_throw() {
+        Tool::TraceSpan span("validate_matrix", "validation");
+        if (!check_DataMat(DataMat)) {
+            delete DataMat;
+            throw std::logic_error("Input Matrix doesn't have the same num of row and col!");
+        };
+        if constexpr (!Directed) {
+            if (!if_symmetric_of_main_diagonal()) {
+                delete DataMat;
+                throw std::logic_error("Input Matrix is not symmetric of the main diagonal!");
+            };
+            if (!check_self_ring()) {
+                delete DataMat;
+                throw std::logic_error(
+                    "Self ring in undirected_graph should be even number, but now there's an odd one!"
+                );
+            }
+        }
+    }
+
+    size_t return_num_of_edges() {
+        Tool::GraphPropertyCache& cache = return_cache();
+        if (!cache.num_of_edges) {
+            cache.num_of_edges = Directed ? DataMat->sum() : DataMat->sum() / 2;
+        }
+        return *cache.num_of_edges;
+    }
+    size_t return_num_of_nodes() {
+        return DataMat->get_sizeof_row();
+    }
+
+public:
+    ~Graph() {
+        delete DataMat;
+    }
+    Graph() = delete; // something has to delete to avoid error
+    /// @brief move constructor
+    Graph(Graph&& another) noexcept {
+        DataMat         = another.DataMat;
+        Version         = another.Version;
+        Cache           = std::move(another.Cache);
+        another.DataMat = nullptr;
+        ++another.Version;
+    }
+    /// @brief copy constructor
+    Graph(const Graph& another) {
+        DataMat = new intMat(another.DataMat);
+    }
+    /// @brief move assignment
+    Graph& operator=(Graph&& another) noexcept {
+        if (this != &another) {
+            delete DataMat;
+            DataMat         = another.DataMat;
+            Version         = another.Version;
+            Cache           = std::move(another.Cache);
+            another.DataMat = nullptr;
+            ++another.Version;
+        }
+        return *this;
+    }
+    /// @brief copy assignment
+    Graph& operator=(const Graph& another) {
+        if (this != &another) {
+            delete DataMat;
+            DataMat = new intMat(another.DataMat);
+            ++Version;
+        }
+        return *this;
+    }
+    Graph(std::initializer_list<
+          std::initializer_list<int>>&& initMat) {
+        intMat::rows_type initVec;
+        intMat::row_type  initVec_inner;
+
+        initVec.reserve(initMat.size());
+        initVec_inner.reserve(initMat.begin()->size());
+
+        for (auto&& currRow : initMat) {
+            for (auto&& currElem : currRow) {
+                initVec_inner.emplace_back(currElem);
+            }
+            initVec.emplace_back(initVec_inner);
+            initVec_inner.clear();
+        }
+
+        DataMat = new intMat(std::move(initVec));
+        check_or_throw();
+    }
+    explicit Graph(std::vector<
+                   std::vector<int>>& initMat) {
+        DataMat = new intMat(initMat);
+        check_or_throw();
+    }
+    explicit Graph(std::vector<
+                   std::vector<int>>&& initMat) {
+        DataMat = new intMat(
+            std::forward<
+                std::vector<std::vector<int>>>(initMat)
+        );
+        check_or_throw();
+    }
+    /// @brief the rows are taken over, @p no_copy
+    explicit Graph(intMat::rows_type&& initMat) {
+        DataMat = new intMat(std::move(initMat));
+        check_or_throw();
+    }
+
+    static Graph create_trivial() {
+        return create_zero();
+    }
+    static Graph create_zero(size_t num_of_nodes = 1) {
+        intMat::row_type initRaw;
+        initRaw.reserve(num_of_nodes);
+        for (size_t i = 0; i < num_of_nodes; ++i) {
+            initRaw.emplace_back(0);
+        }
+        intMat::rows_type initMat;
+        initMat.reserve(num_of_nodes);
+        for (size_t i = 0; i < num_of_nodes; ++i) {
+            initMat.emplace_back(initRaw);
+        }
+        Graph res(std::move(initMat));
+        return res;
+    }
+    static bool is_same(
+        const Graph& lhs,
+        const Graph& rhs
+    ) {
+        auto l_mat = lhs.DataMat;
+        auto r_mat = rhs.DataMat;
+        return Tool::Matrix<int>::A_eq_B(l_mat, r_mat);
+    }
+
+    /// @brief judge if has a euler circle, @b cached
+    /// @note
+    ///     @e directed   => in_deg == out_deg for each vertex, and strongly connective
+    ///     @e undirected => deg is even for each vertex, and connective
+    static bool if_has_euler_circle(Graph& input) {
+        Tool::GraphPropertyCache& cache = input.return_cache();
+        if (cache.if_has_euler_circle) {
+            return *cache.if_has_euler_circle;
+        }
+        bool res = true;
+        if (!if_trivial(input)) {
+            {
+                Tool::TraceSpan span("check_degrees", "degree");
+                auto&           out_degree = return_out_degrees(input);
+                auto&           in_degree  = return_in_degrees(input);
+                for (size_t index = 0; index < out_degree.size() && res; ++index) {
+                    res = Directed
+                        ? out_degree[index] == in_degree[index]
+                        : out_degree[index] % 2 == 0;
+                }
+            }
+            res = res && if_connective(input);
+        }
+        cache.if_has_euler_circle = res;
+        return res;
+    }
+
+    /// @brief judge if is a connective graph ( @e directed => strongly connective ), @b cached
+    static bool if_connective(Graph& input) {
+        Tool::HotPathCounters::add(Tool::HotPathCounter::connectivity_checks);
+        return return_strongly_connected_components(input).num_of_components == 1;
+    }
+
+    /// @brief @b strongly_connected_components , with the @b condensation_DAG , @b cached
+    /// @note @e undirected => @b connected_components
+    static const Tool::StronglyConnectedComponents&
+    return_strongly_connected_components(Graph& input) {
+        Tool::GraphPropertyCache& cache = input.return_cache();
+        if (!cache.components) {
+            Tool::TraceSpan span("connectivity", "connectivity");
+            view_type       inputView(*(input.DataMat));
+            cache.components = Tool::GeneralGraphToolSet::return_strongly_connected_components(
+                inputView
+            );
+        }
+        return *cache.components;
+    }
+
+    /// @brief @b bridges of the ( @e related ) @b undirected graph, @b cached
+    /// @return sorted { smaller vertex, larger vertex }
+    static const std::vector<std::pair<size_t, size_t>>&
+    return_bridges(Graph& input) {
+        Tool::GraphPropertyCache& cache = input.return_cache();
+        if (!cache.bridges) {
+            Tool::Matrix<int>           undirected_DataMat = return_undirected_matrix(input);
+            Tool::DenseGraphView<false> undirected_view(undirected_DataMat);
+            cache.bridges = Tool::GeneralGraphToolSet::return_bridges(undirected_view);
+        }
+        return *cache.bridges;
+    }
+
+    /// @brief degrees, [vertex - 1] , @b cached ( @e undirected => in == out , self ring counts `2`)
+    static const std::vector<size_t>& return_out_degrees(Graph& input) {
+        input.fill_degrees();
+        return *input.Cache.out_degree;
+    }
+    static const std::vector<size_t>& return_in_degrees(Graph& input) {
+        input.fill_degrees();
+        return *input.Cache.in_degree;
+    }
+
+    /// @brief version of the graph, bumped by every edit
+    static size_t return_version(Graph& input) {
+        return input.Version;
+    }
+
+    /// @brief @b edits => the version is bumped, so all cached properties are dropped
+    static void add_an_edge(Graph& input, size_t from, size_t to) {
+        Tool::HotPathCounters::add(Tool::HotPathCounter::edges_restored);
+        intMat& inputDataMat = *(input.DataMat);
+        if constexpr (Directed) {
+            inputDataMat(from, to) += 1;
+        } else {
+            inputDataMat(from, to) += 1;
+            inputDataMat(to, from) += 1; // self ring => `2`
+        }
+        ++input.Version;
+    }
+    static void cut_an_edge(Graph& input, size_t from, size_t to) {
+        intMat& inputDataMat = *(input.DataMat);
+        if (inputDataMat(from, to) == 0) {
+            throw std::logic_error("No edge between two vertexes!");
+        }
+        Tool::HotPathCounters::add(Tool::HotPathCounter::edges_cut);
+        if constexpr (Directed) {
+            inputDataMat(from, to) -= 1;
+        } else {
+            inputDataMat(from, to) -= 1;
+            inputDataMat(to, from) -= 1; // self ring => `2`
+        }
+        ++input.Version;
+    }
+
+    /// @brief @p create @b related_undirected_matrix
+    /// @note @e undirected => just a copy
+    static Tool::Matrix<int> return_undirected_matrix(
+        Graph& input
+    ) {
+        Tool::Matrix<int> res = *(input.DataMat);
+        if constexpr (!Directed) {
+            return res;
+        }
+        size_t num_of_row = res.get_sizeof_row();
+        size_t num_of_col = res.get_sizeof_col();
+        // first deal with self ring
+        for (size_t row = 1; row <= num_of_row; ++row) {
+            res(row, row) *= 2;
+        }
+        // then deal with other edge
+        for (size_t row = 1; row <= num_of_row; ++row) {
+            for (size_t col = 1 + row; col <= num_of_col; ++col) {
+                int expectation_num = res(row, col) + res(col, row);
+                res(row, col)       = expectation_num;
+                res(col, row)       = expectation_num;
+            }
+        }
+        return res;
+    }
+
+    /// @brief judge if the input graph is a trivial graph
+    static bool if_trivial(Graph& input) {
+        Tool::Matrix<int>& inputDataMat = *(input.DataMat);
+        if (inputDataMat.get_sizeof_col() != 1
+            || inputDataMat.get_sizeof_row() != 1) {
+            return false;
+        }
+        if (inputDataMat(1, 1) != 0) {
+            return false;
+        }
+        return true;
+    }
+
+    /**
+     * @brief @e all @b euler_circle , as @b rotations of only one circle
+     * @note T(n) = O( V + E ) , each circle is a @b lazy_view , see @e euler_circle_set.hpp
+     * @return empty set if there's @b no_euler_circle
+     */
+    static Tool::EulerCircleSet
+    return_euler_circle_set_rotated(Graph& input) {
+        if (!if_has_euler_circle(input)) {
+            return {};
+        }
+        view_type inputView(*(input.DataMat)); // won't be modified
+        return Tool::EulerCircleSet::build(inputView);
+    }
+
+    /// @brief try to return @e all @b euler_circle
+    /// @note built from @b return_euler_circle_set_rotated , only the output costs O( V * E )
+    static std::vector<Tool::EulerResult>
+    return_euler_circle_set_H_fastest(Graph& input) {
+        std::vector<Tool::EulerResult> res = {};
+
+        size_t all_vertex = input.return_num_of_nodes();
+
+        Tool::EulerCircleSet circle_set = return_euler_circle_set_rotated(input);
+        if (!circle_set.if_has_euler_circle()) {
+            res.push_back(Tool::EulerResult::no_euler_circle());
+            return res;
+        }
+        if (input.if_trivial(input)) {
+            res.push_back(Tool::EulerResult::trivial(1));
+            return res;
+        }
+        res.reserve(all_vertex);
+        for (size_t curr_vertex = 1;
+             curr_vertex <= all_vertex;
+             ++curr_vertex) {
+            Tool::EulerResult an_euler_circle;
+            an_euler_circle.status             = Tool::EulerStatus::found;
+            an_euler_circle.vertices           = circle_set[curr_vertex].to_vector();
+            an_euler_circle.stats.num_of_edges = input.return_num_of_edges();
+            res.push_back(std::move(an_euler_circle));
+        }
+
+        return res;
+    }
+    static std::vector<Tool::EulerResult>
+    return_euler_circle_set_H(Graph& input) {
+        std::vector<Tool::EulerResult> res = {};
+
+        size_t all_vertex = input.return_num_of_nodes();
+
+        if (!input.if_has_euler_circle(input)) {
+            res.push_back(Tool::EulerResult::no_euler_circle());
+            return res;
+        }
+        res.reserve(all_vertex);
+        for (size_t curr_vertex = 1;
+             curr_vertex <= all_vertex;
+             ++curr_vertex) {
+            res.push_back(input.return_an_euler_circle_H(input, curr_vertex));
+        }
+
+        return res;
+    }
+    /// @note one @b FleuryScratch for all start vertices => its matrices are @p reused
+    static std::vector<Tool::EulerResult>
+    return_euler_circle_set_F(Graph& input) {
+        std::vector<Tool::EulerResult> res = {};
+
+        size_t all_vertex = input.return_num_of_nodes();
+
+        if (!input.if_has_euler_circle(input)) {
+            res.push_back(Tool::EulerResult::no_euler_circle());
+            return res;
+        }
+        if (input.if_trivial(input)) {
+            res.push_back(Tool::EulerResult::trivial(1));
+            return res;
+        }
+        std::optional<Tool::Matrix<int>> related_undirected_DataMat;
+        if constexpr (Directed) {
+            related_undirected_DataMat.emplace(Graph::return_undirected_matrix(input));
+        }
+        FleuryScratch scratch;
+        res.reserve(all_vertex);
+        for (size_t curr_vertex = 1;
+             curr_vertex <= all_vertex;
+             ++curr_vertex) {
+            load_fleury_scratch(input, related_undirected_DataMat, scratch);
+            res.push_back(walk_an_euler_circle_F(input, curr_vertex, scratch));
+        }
+
+        return res;
+    }
+    /**
+     * @brief @b return_euler_circle_set_F , but the start vertices are solved @b concurrently on `pool`
+     * @note
+            Runs of different start vertices are @p independent =>
+                @b one task per start vertex, written into @b slot `vertex - 1` (the same order),
+                @b each_worker owns a @b FleuryScratch , reused by every start it takes,
+                the graph itself (and its related undirected matrix) is @p only_read .
+            So the whole set takes about the time of the @b slowest start (with enough cores).
+     */
+    static std::vector<Tool::EulerResult>
+    return_euler_circle_set_F(Graph& input, Tool::ThreadPool& pool) {
+        std::vector<Tool::EulerResult> res = {};
+
+        size_t all_vertex = input.return_num_of_nodes();
+
+        if (!input.if_has_euler_circle(input)) {
+            res.push_back(Tool::EulerResult::no_euler_circle());
+            return res;
+        }
+        if (input.if_trivial(input)) {
+            res.push_back(Tool::EulerResult::trivial(1));
+            return res;
+        }
+        input.return_num_of_edges(); // cached ahead => workers only read the cache
+
+        std::optional<Tool::Matrix<int>> related_undirected_DataMat;
+        if constexpr (Directed) {
+            related_undirected_DataMat.emplace(Graph::return_undirected_matrix(input));
+        }
+        std::vector<FleuryScratch> scratches(pool.return_num_of_threads());
+        res.resize(all_vertex);
+        for (size_t curr_vertex = 1;
+             curr_vertex <= all_vertex;
+             ++curr_vertex) {
+            pool.submit([&input, &related_undirected_DataMat, &scratches, &res, &pool, curr_vertex] {
+                FleuryScratch& scratch = scratches[pool.return_worker_index()];
+                load_fleury_scratch(input, related_undirected_DataMat, scratch);
+                res[curr_vertex - 1] = walk_an_euler_circle_F(input, curr_vertex, scratch);
+            });
+        }
+        pool.wait();
+
+        return res;
+    }
+    /// @brief the same, on a pool of its own
+    static std::vector<Tool::EulerResult>
+    return_euler_circle_set_F_parallel(
+        Graph& input,
+        size_t num_of_threads = std::thread::hardware_concurrency()
+    ) {
+        Tool::ThreadPool pool(std::min(num_of_threads, input.return_num_of_nodes()));
+        return return_euler_circle_set_F(input, pool);
+    }
+
+    /// @brief @b Fleury_liked_Algorithm ( @b not_recommended )
+    /// @warning @b This_Fleury-liked_function_is_not_recommended
+    /**
+     * @brief @b Fleury_liked_Algorithm
+     * @note
+            Originally, @e Fleury_algorithm is to @p avoid_passing_the_bridge,
+            but I haven't learnt @e Tarjan_algorithm to figure out the bridge.
+
+            Thus, I made an @p alternation => I've found that
+                ` the edge to broke the @e connectivity of an @b connective_graph `
+            is always the bridge, only if the original graph is an
+                ` @b undirected_connective ` one
+
+            So everything is simple =>
+            1). |
+                |-> In an @e undirected_graph , delete an @b iterable_edge ,
+                    if there's only one, then you need to add the start vertex into
+                        ` @b ignored_vertex_set `.
+                    Then you just judge the @b partial_connectivity of
+                        ` @b {DataMat} @p <sub> @b ignored_vertex `
+                    (a) If it's @b partial_connective , @e OK! , you just go ahead!
+                    (b) Else , that's a wrong edge, you need to add it back
+                        |-> then you should find another  @b iterable_edge
+            2). |
+                |-> In an @e directed_graph , you need to =>
+                    |-> (1) transfer the @b DataMat into an @b Undirected_One
+                        (2) do @p edge_iteration_with_deletion in
+                                ` @b Undirected_Mat ` and ` @b Directed(Original)_Mat `
+                            @p AT_THE_SAME_TIME
+                        (3) @b ONLY_USE the @b Undirected_Mat for
+                                (a) @p BUILD @b ignored_vertex_set
+                                (b) @p JUDGE @b partial_connectivity
+
+            But, T(n) = O( (n^2) * log(n) ) [ @b A_BIG_COST ]
+                            ^^^    ^^^^^^
+                            |           |==> Quick_Power
+                            |==> Fast Matrix Multiply
+
+            Hope You could @p Enjoy! @b ~~(^ω^)~~
+
+     * @param input
+     * @param vertex
+     * @return Tool::EulerResult
+     */
+    static Tool::EulerResult
+    return_an_euler_circle_F(Graph& input, size_t vertex) {
+        if (!input.if_has_euler_circle(input)) {
+            return Tool::EulerResult::no_euler_circle();
+        }
+        if (input.if_trivial(input)) {
+            return Tool::EulerResult::trivial(vertex);
+        }
+        FleuryScratch scratch;
+        scratch.DataMat.emplace(*(input.DataMat)); // copy one
+        if constexpr (Directed) {
+            scratch.UndirectedDataMat.emplace(Graph::return_undirected_matrix(input));
+        }
+        return walk_an_euler_circle_F(input, vertex, scratch);
+    }
+
+    /// @brief working matrices of @b one Fleury run, kept by the caller => reused across runs
+    struct FleuryScratch {
+        std::optional<Tool::Matrix<int>> DataMat;           // copy of the graph, edges will be cut
+        std::optional<Tool::Matrix<int>> UndirectedDataMat; // @e directed => the related undirected one
+    };
+    /// @brief (re)load `scratch` => storage is @p reused if it's loaded before
+    /// @param related_undirected_DataMat @e directed => @b return_undirected_matrix , ignored otherwise
+    static void load_fleury_scratch(
+        Graph&                            input,
+        std::optional<Tool::Matrix<int>>& related_undirected_DataMat, // only read
+        FleuryScratch&                    scratch
+    ) {
+        if (scratch.DataMat) {
+            Tool::Matrix<int>::A_overwritten_by_B(*scratch.DataMat, *(input.DataMat));
+        } else {
+            scratch.DataMat.emplace(*(input.DataMat));
+        }
+        if constexpr (Directed) {
+            if (scratch.UndirectedDataMat) {
+                Tool::Matrix<int>::A_overwritten_by_B(*scratch.UndirectedDataMat, *related_undirected_DataMat);
+            } else {
+                scratch.UndirectedDataMat.emplace(*related_undirected_DataMat);
+            }
+        }
+    }
+    /// @attention @b no_check => the graph @p must_have an euler circle, and @p must_not be trivial,
+    ///            `scratch` @p must_be loaded (it's consumed)
+    static Tool::EulerResult
+    walk_an_euler_circle_F(Graph& input, size_t vertex, FleuryScratch& scratch) {
+        Tool::TraceSpan   span("fleury", "construction");
+        Tool::EulerResult res;
+        res.stats.num_of_edges = input.return_num_of_edges();
+
+        Tool::Matrix<int>& inputDataMat = *scratch.DataMat;
+
+        // @e directed => connectivity is judged on the related undirected one
+        Tool::Matrix<int>& undirected_DataMat
+            = Directed ? *scratch.UndirectedDataMat : inputDataMat;
+
+        // Fleury Algorithm
+        size_t curr_vertex = vertex;
+        size_t num_of_col  = inputDataMat.get_sizeof_col();
+        size_t num_of_edge = input.return_num_of_edges();
+
+        std::stack<size_t, Tool::TrackedVector<size_t>> path; // res
+
+        std::unordered_set<size_t> ignored_vertex {};
+        ignored_vertex.reserve(num_of_col);
+
+        while (num_of_edge > 0) { // must do it ahead (at least for once)
+            // @e directed => (in_deg + out_deg) == related undirected deg
+            size_t curr_deg = undirected_DataMat.sum_of_row(curr_vertex);
+            if (curr_deg == 0) {
+                break;
+            }
+            for (size_t col = 1; col <= num_of_col; ++col) {
+                auto& curr_elem = inputDataMat(curr_vertex, col);
+                if (curr_elem == 0) {
+                    continue;
+                } else {
+                    path.push(curr_vertex);
+                    // try to -1 each time and then judge the connectivity
+                    if constexpr (Directed) {
+                        cut_an_directed_edge_of(
+                            inputDataMat,
+                            curr_vertex,
+                            col
+                        );
+                    }
+                    size_t subbed = cut_an_undirected_edge_of(
+                        undirected_DataMat,
+                        curr_vertex,
+                        col
+                    );
+                    curr_deg -= subbed;
+                    --num_of_edge;
+                    ++res.stats.num_of_steps;
+                    Tool::HotPathCounters::add(Tool::HotPathCounter::edges_cut);
+                    if (curr_deg == 0) { // don't judge the connectivity
+                        // that deleted path is the only path for current vertex
+                        // then we have to adapt that path, without considering connectivity
+                        ignored_vertex.emplace(curr_vertex);
+                        curr_vertex = col;
+                        break;
+                    } else { // need to judge the connectivity
+                        if (!input.if_partial_connective(
+                                undirected_DataMat,
+                                ignored_vertex
+                            )) {
+                            path.pop();
+                            if constexpr (Directed) {
+                                add_an_directed_edge_of(
+                                    inputDataMat,
+                                    curr_vertex,
+                                    col
+                                );
+                            }
+                            add_an_undirected_edge_of(
+                                undirected_DataMat,
+                                curr_vertex,
+                                col
+                            );
+                            curr_deg += subbed;
+                            ++num_of_edge;
+                            ++res.stats.num_of_backtracks;
+                            Tool::HotPathCounters::add(Tool::HotPathCounter::edges_restored);
+                            Tool::HotPathCounters::add(Tool::HotPathCounter::fleury_backtracks);
+                            continue;
+                        }
+                        curr_vertex = col;
+                        break;
+                    }
+                }
+            }
+        };
+        Tool::HotPathCounters::add(Tool::HotPathCounter::traversal_steps, res.stats.num_of_steps);
+
+        res.vertices.reserve(path.size() + 1);
+        while (!path.empty()) {
+            res.vertices.push_back(path.top());
+            path.pop();
+        }
+        std::reverse(res.vertices.begin(), res.vertices.end());
+
+        /**
+         * @brief
+                the last vertex is the start vertex
+                but when you try to push it into the stack in the `while` loop,
+                you'll find it's impossible because `edge == 0` and you can't get in
+                so you have to add it manually
+         * @param res
+         */
+        res.vertices.push_back(vertex);
+        res.status = Tool::EulerStatus::found;
+
+        return res;
+    }
+
+    /// @brief Hierholzer Algorithm, T(n)=O(n), fastest
+    /// @ref https://www.jianshu.com/p/8394b8e5b878
+    /// @attention this is a reference, not the original work of me!
+    static Tool::EulerResult
+    return_an_euler_circle_H_fastest(Graph& input, size_t vertex) {
+        if (!if_has_euler_circle(input)) { // cached
+            return Tool::EulerResult::no_euler_circle();
+        }
+        if (if_trivial(input)) {
+            return Tool::EulerResult::trivial(vertex);
+        }
+        Tool::Matrix<int> inputDataMat(input.DataMat); // no ref
+        view_type         inputView(inputDataMat);
+        return Tool::GeneralGraphToolSet::walk_an_euler_circle_H_fastest(
+            inputView,
+            vertex
+        );
+    }
+
+    /// @brief Hierholzer Algorithm, T(n)=O(n)
+    /// @brief This one may be slower, but it's easier to comprehend
+    /// @e This_one_is_totally_originally_written_by_me
+    /// @e Hierholzer_Algorithm_YYDS
+    /// @attention @b known_invalid on multigraphs (and some simple graphs, e.g. an undirected torus) =>
+    ///            use @b H_linear / @b H_fastest where the circle matters
+    static Tool::EulerResult
+    return_an_euler_circle_H(Graph& input, size_t vertex) {
+        if (!if_has_euler_circle(input)) { // cached
+            return Tool::EulerResult::no_euler_circle();
+        }
+        if (if_trivial(input)) {
+            return Tool::EulerResult::trivial(vertex);
+        }
+        Tool::Matrix<int> inputDataMat(input.DataMat); // no ref
+        view_type         inputView(inputDataMat);
+        return Tool::GeneralGraphToolSet::walk_an_euler_circle_H(
+            inputView,
+            vertex
+        );
+    }
+
+    /**
+     * @brief Hierholzer Algorithm, @b truly T(n) = O( V + E ) , see @e linear_hierholzer.hpp
+     * @return vertices of the circle ( @b first == @b last == `vertex` ),
+     *         @b empty if there's @b no_euler_circle
+     */
+    static Tool::TrackedVector<std::uint32_t>
+    return_an_euler_circle_H_linear(Graph& input, size_t vertex) {
+        if (!if_has_euler_circle(input)) {
+            return {};
+        }
+        if (if_trivial(input)) {
+            return { static_cast<std::uint32_t>(vertex) };
+        }
+        view_type inputView(*(input.DataMat)); // won't be modified
+        Tool::LinearHierholzer engine;
+        engine.load(inputView);
+        return std::move(engine.run(vertex));
+    }
+    /// @brief the same, but on the caller's @b scratch engine (its buffers are reused across graphs)
+    static Tool::EulerResult
+    return_an_euler_circle_H_linear(Graph& input, size_t vertex, Tool::LinearHierholzer& scratch) {
+        if (!if_has_euler_circle(input)) {
+            return Tool::EulerResult::no_euler_circle();
+        }
+        if (if_trivial(input)) {
+            return Tool::EulerResult::trivial(vertex);
+        }
+        view_type inputView(*(input.DataMat)); // won't be modified
+        scratch.load(inputView);
+
+        Tool::EulerResult res;
+        auto&             circle = scratch.run(vertex);
+        res.status               = Tool::EulerStatus::found;
+        res.vertices.assign(circle.begin(), circle.end());
+        res.stats.num_of_edges = scratch.return_num_of_edges();
+        res.stats.num_of_steps = scratch.return_num_of_edges();
+        return res;
+    }
+    /**
+     * @brief a @b resumable walk from `vertex` => loaded and started, nothing is walked yet
+     * @note drive it by @b advance(N) , see @e linear_hierholzer.hpp
+     * @return std::nullopt if there's @b no_euler_circle
+     */
+    static std::optional<Tool::LinearHierholzer>
+    return_euler_traversal(Graph& input, size_t vertex) {
+        if (!if_has_euler_circle(input)) {
+            return std::nullopt;
+        }
+        view_type              inputView(*(input.DataMat)); // won't be modified
+        Tool::LinearHierholzer res;
+        res.load(inputView);
+        res.start(vertex);
+        return res;
+    }
+
+    /**
+     * @brief Hierholzer Algorithm on @b several_threads , see @e parallel_hierholzer.hpp
+     * @return vertices of the circle ( @b first == @b last == `vertex` ),
+     *         @b empty if there's @b no_euler_circle
+     */
+    static Tool::TrackedVector<std::uint32_t>
+    return_an_euler_circle_H_parallel(
+        Graph& input,
+        size_t vertex,
+        size_t num_of_threads = std::thread::hardware_concurrency()
+    ) {
+        if (!if_has_euler_circle(input)) {
+            return {};
+        }
+        if (if_trivial(input)) {
+            return { static_cast<std::uint32_t>(vertex) };
+        }
+        view_type inputView(*(input.DataMat)); // won't be modified
+        Tool::ParallelHierholzer engine(num_of_threads);
+        engine.load(inputView);
+        return std::move(engine.run(vertex));
+    }
+
+    /**
+     * @brief @b all distinct euler circles from `vertex` , @b lazily , see @e euler_circle_enumerator.hpp
+     * @return a generator of spans ( @b first == @b last == `vertex` ),
+     *         each span is valid until the next one is asked for,
+     *         @b empty if there's @b no_euler_circle
+     */
+    static Tool::Generator<std::span<const std::uint32_t>>
+    return_euler_circles(Graph& input, size_t vertex) {
+        if (!if_has_euler_circle(input)) {
+            return {};
+        }
+        view_type inputView(*(input.DataMat)); // won't be modified
+        Tool::EulerCircleEnumerator engine;
+        engine.load(inputView);
+        return Tool::EulerCircleEnumerator::enumerate(std::move(engine), vertex);
+    }
+
+    /**
+     * @brief num of euler circles by the @b BEST_theorem , see @e euler_circle_counter.hpp
+     * @return exact decimal string, @b "0" if there's @b no_euler_circle
+     */
+    static std::string return_num_of_euler_circles(Graph& input)
+        requires Directed
+    {
+        if (!if_has_euler_circle(input)) {
+            return "0";
+        }
+        view_type inputView(*(input.DataMat)); // won't be modified
+        return Tool::EulerCircleCounter::return_num_of_euler_circles(inputView);
+    }
+    /// @brief same as above, but modulo `prime` (a prime below 2^63)
+    static std::uint64_t return_num_of_euler_circles_mod(Graph& input, std::uint64_t prime)
+        requires Directed
+    {
+        if (!if_has_euler_circle(input)) {
+            return 0;
+        }
+        view_type inputView(*(input.DataMat)); // won't be modified
+        return Tool::EulerCircleCounter::return_num_of_euler_circles_mod(inputView, prime);
+    }
+
+    /// @brief operator overloads
+    friend bool operator==(Graph& lhs, Graph& rhs) {
+        bool if_data_mat_same = *(lhs.DataMat) == *(rhs.DataMat);
+        return if_data_mat_same;
+    }
+    friend bool operator!=(Graph& lhs, Graph& rhs) {
+        return !(lhs == rhs);
+    }
+};
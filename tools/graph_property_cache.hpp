@@ -0,0 +1,52 @@
+/**
+ * @file graph_property_cache.hpp
+ * @author Eden (edwardwang33773@gmail.com)
+ * @brief Lazily filled cache of @b derived_properties of a graph, invalidated by a @b version_counter
+ * @note
+        Every edit of a graph bumps its @b version .
+        @b sync(version) drops everything if the cache was filled for another version,
+        then each property is computed on its first query, and costs O(1) from then on.
+
+        @b out_degree / @b in_degree     => [vertex - 1] ( @e undirected => the same, self ring counts `2`)
+        @b num_of_edges                  => self ring counts `1`
+        @b components                    => strongly connected ( @e undirected => connected)
+        @b if_has_euler_circle           => from the degrees and the components
+        @b bridges                       => of the ( @e related ) @b undirected graph
+ * @version 0.1
+ * @date 2022-10-28
+ *
+ * @copyright Copyright (c) 2022
+ *
+ */
+
+#pragma once
+
+#include "general_graph_tool_set.hpp"
+#include <optional>
+#include <utility>
+#include <vector>
+
+namespace Tool {
+
+struct GraphPropertyCache {
+    static constexpr size_t not_cached = static_cast<size_t>(-1);
+
+    size_t version = not_cached;
+
+    std::optional<std::vector<size_t>>                    out_degree;
+    std::optional<std::vector<size_t>>                    in_degree;
+    std::optional<size_t>                                 num_of_edges;
+    std::optional<StronglyConnectedComponents>            components;
+    std::optional<bool>                                   if_has_euler_circle;
+    std::optional<std::vector<std::pair<size_t, size_t>>> bridges;
+
+    /// @brief drop everything if the graph has been edited since the cache was filled
+    void sync(size_t current_version) {
+        if (version != current_version) {
+            *this   = GraphPropertyCache {};
+            version = current_version;
+        }
+    }
+};
+
+} // namespace Tool
@@ -0,0 +1,162 @@
+/**
+ * @file graph_view.hpp
+ * @author Eden (edwardwang33773@gmail.com)
+ * @brief @b GraphView concept, and the @b dense_matrix backend of it
+ * @note
+        Every algorithm in @e GeneralGraphToolSet which is templated on @b GraphView
+        only touches the graph through the methods below, so any storage
+        (dense matrix, CSR, bitset, ...) could be plugged in, and the compiler
+        generates a @b specialized , @b fully_inlined version for each of them
+        (there's @p no_virtual_dispatch ).
+
+        @b vertex @p start_from_`1` , and `0` means @b no_vertex .
+
+        @b if_directed                  => compile-time directedness
+        @b return_num_of_nodes()        => num of vertexes
+        @b return_num_of_edges()        => num of edges (self ring counts `1`)
+        @b return_first_iterable(v)     => first neighbor of `v`, `0` if there's none
+        @b return_next_iterable(v, u)   => neighbor of `v` after `u`, `0` if there's none
+        @b return_out_degree(v)         => @e undirected : self ring counts `2`
+        @b return_in_degree(v)          => @e undirected : same as `out_degree`
+        @b return_multiplicity(v, u)    => num of edges between (self ring counts `1`)
+        @b cut_an_edge_of(v, u)         => multiplicity - 1 (both sides if undirected)
+        @b add_an_edge_of(v, u)         => multiplicity + 1 (both sides if undirected)
+ * @version 0.1
+ * @date 2022-10-21
+ *
+ * @copyright Copyright (c) 2022
+ *
+ */
+
+#pragma once
+
+#include "Matrix.hpp"
+#include "adjacency_bitset.hpp"
+#include "hot_path_counters.hpp"
+#include "memory_tracking.hpp"
+#include <concepts>
+#include <stdexcept>
+#include <vector>
+
+namespace Tool {
+
+template <typename G>
+concept GraphView = requires(G& graph, size_t vertex, size_t col) {
+    { G::if_directed } -> std::convertible_to<bool>;
+    { graph.return_num_of_nodes() } -> std::convertible_to<size_t>;
+    { graph.return_num_of_edges() } -> std::convertible_to<size_t>;
+    { graph.return_first_iterable(vertex) } -> std::convertible_to<size_t>;
+    { graph.return_next_iterable(vertex, col) } -> std::convertible_to<size_t>;
+    { graph.return_out_degree(vertex) } -> std::convertible_to<size_t>;
+    { graph.return_in_degree(vertex) } -> std::convertible_to<size_t>;
+    { graph.return_multiplicity(vertex, col) } -> std::convertible_to<size_t>;
+    graph.cut_an_edge_of(vertex, col);
+    graph.add_an_edge_of(vertex, col);
+};
+
+/**
+ * @brief @b GraphView over a @b Tool::Matrix<int> (adjacency matrix)
+ * @note
+        @b DataMat is @p referenced , not copied => @p copy_it_ahead if you'll cut edges.
+        Neighbors are scanned with an @b AdjacencyBitset , degrees are cached,
+        both of them are kept in sync by @b cut_an_edge_of / @b add_an_edge_of .
+ */
+template <bool Directed>
+class DenseGraphView {
+    Tool::Matrix<int>&          DataMat;
+    Tool::AdjacencyBitset       Bitset;
+    Tool::TrackedVector<size_t> OutDeg; // OutDeg[vertex - 1]
+    Tool::TrackedVector<size_t> InDeg;  // InDeg[vertex - 1], unused if undirected
+    size_t                      NumOf_Edges = 0;
+
+public:
+    static constexpr bool if_directed = Directed;
+
+    explicit DenseGraphView(Tool::Matrix<int>& inputDataMat)
+        : DataMat(inputDataMat)
+        , Bitset(inputDataMat) {
+        size_t num_of_nodes = DataMat.get_sizeof_row();
+        OutDeg.assign(num_of_nodes, 0);
+        if constexpr (Directed) {
+            InDeg.assign(num_of_nodes, 0);
+        }
+        size_t sum = 0;
+        for (size_t row = 1; row <= num_of_nodes; ++row) {
+            for (size_t col = Bitset.first_iterable(row);
+                 col != 0;
+                 col = Bitset.next_iterable(row, col)) {
+                size_t curr_elem = DataMat(row, col);
+                OutDeg[row - 1] += curr_elem;
+                if constexpr (Directed) {
+                    InDeg[col - 1] += curr_elem;
+                }
+                sum += curr_elem;
+            }
+        }
+        NumOf_Edges = Directed ? sum : sum / 2;
+    }
+
+    constexpr size_t return_num_of_nodes() {
+        return DataMat.get_sizeof_row();
+    }
+    constexpr size_t return_num_of_edges() {
+        return NumOf_Edges;
+    }
+    constexpr size_t return_first_iterable(size_t vertex) {
+        return Bitset.first_iterable(vertex);
+    }
+    constexpr size_t return_next_iterable(size_t vertex, size_t col) {
+        return Bitset.next_iterable(vertex, col);
+    }
+    constexpr size_t return_out_degree(size_t vertex) {
+        return OutDeg[vertex - 1];
+    }
+    constexpr size_t return_in_degree(size_t vertex) {
+        if constexpr (Directed) {
+            return InDeg[vertex - 1];
+        } else {
+            return OutDeg[vertex - 1];
+        }
+    }
+    constexpr size_t return_multiplicity(size_t vertex, size_t col) {
+        if constexpr (!Directed) {
+            if (vertex == col) {
+                return DataMat(vertex, col) / 2; // self ring is stored as `2`
+            }
+        }
+        return DataMat(vertex, col);
+    }
+    void cut_an_edge_of(size_t vertex, size_t col) {
+        if (DataMat(vertex, col) == 0) {
+            throw std::logic_error("No edge between two vertexes!");
+        }
+        HotPathCounters::add(HotPathCounter::edges_cut);
+        DataMat(vertex, col) -= 1;
+        DataMat(col, vertex) -= Directed ? 0 : 1;
+        Bitset.sync(DataMat, vertex, col);
+        --OutDeg[vertex - 1];
+        if constexpr (Directed) {
+            --InDeg[col - 1];
+        } else {
+            Bitset.sync(DataMat, col, vertex);
+            --OutDeg[col - 1];
+        }
+        --NumOf_Edges;
+    }
+    void add_an_edge_of(size_t vertex, size_t col) {
+        HotPathCounters::add(HotPathCounter::edges_restored);
+        DataMat(vertex, col) += 1;
+        DataMat(col, vertex) += Directed ? 0 : 1;
+        Bitset.set(vertex, col);
+        ++OutDeg[vertex - 1];
+        if constexpr (Directed) {
+            ++InDeg[col - 1];
+        } else {
+            Bitset.set(col, vertex);
+            ++OutDeg[col - 1];
+        }
+        ++NumOf_Edges;
+    }
+};
+
+} // namespace Tool
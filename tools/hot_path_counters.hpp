@@ -0,0 +1,182 @@
+/**
+ * @file hot_path_counters.hpp
+ * @author Eden (edwardwang33773@gmail.com)
+ * @brief HotPathCounters => what a query has @b done , counted on the @b hot_path , @p compiled_out by default
+ * @note
+        Enabled by @b DISCRETE_MATH_COUNTERS ( @e xmake => `xmake f --counters=y` ),
+        otherwise @b add is an empty @p constexpr_if => no code, no memory.
+
+        @b HotPathCounter =>
+            matrix_allocations / matrix_bytes   => @e Matrix buffers (copies, zero mats, products)
+            matrix_multiplications              => @e Matrix * @e Matrix
+            connectivity_checks                 => @b if_connective (also called by the partial one)
+            partial_connectivity_checks         => @b if_partial_connective
+            edges_cut / edges_restored          => on a @e GraphView , and in the Fleury loop
+            fleury_backtracks                   => bridges refused by Fleury
+            traversal_steps                     => edges walked by H , H_fastest , F and H_linear
+
+        Each thread owns a @b block of counters (written without any @b RMW , only the owner writes),
+        all blocks are kept in a @b registry =>
+            @b return_thread_snapshot()  => the calling thread
+            @b return_global_snapshot()  => all live threads + the ones which have exited
+        A snapshot is a plain array => `after - before` gives what one query has done.
+ * @version 0.1
+ * @date 2022-10-28
+ *
+ * @copyright Copyright (c) 2022
+ *
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <ostream>
+#include <string_view>
+#include <vector>
+
+namespace Tool {
+
+enum class HotPathCounter : unsigned short {
+    matrix_allocations          = 0,
+    matrix_bytes                = 1,
+    matrix_multiplications      = 2,
+    connectivity_checks         = 3,
+    partial_connectivity_checks = 4,
+    edges_cut                   = 5,
+    edges_restored              = 6,
+    fleury_backtracks           = 7,
+    traversal_steps             = 8,
+};
+
+struct CounterSnapshot {
+    static constexpr size_t num_of_counters = 9;
+
+    static constexpr std::array<std::string_view, num_of_counters> names = {
+        "matrix_allocations",
+        "matrix_bytes",
+        "matrix_multiplications",
+        "connectivity_checks",
+        "partial_connectivity_checks",
+        "edges_cut",
+        "edges_restored",
+        "fleury_backtracks",
+        "traversal_steps",
+    };
+
+    std::array<std::uint64_t, num_of_counters> values = {};
+
+    std::uint64_t operator[](HotPathCounter counter) const {
+        return values[static_cast<size_t>(counter)];
+    }
+    CounterSnapshot operator-(const CounterSnapshot& before) const {
+        CounterSnapshot res;
+        for (size_t index = 0; index < num_of_counters; ++index) {
+            res.values[index] = values[index] - before.values[index];
+        }
+        return res;
+    }
+    CounterSnapshot& operator+=(const CounterSnapshot& another) {
+        for (size_t index = 0; index < num_of_counters; ++index) {
+            values[index] += another.values[index];
+        }
+        return *this;
+    }
+    /// @brief "name => value" per line
+    void print(std::ostream& output) const {
+        for (size_t index = 0; index < num_of_counters; ++index) {
+            output << names[index];
+            for (size_t pad = names[index].size(); pad < 28; ++pad) {
+                output << ' ';
+            }
+            output << " => " << values[index] << '\n';
+        }
+    }
+};
+
+class HotPathCounters {
+public:
+#if defined(DISCRETE_MATH_COUNTERS)
+    static constexpr bool if_enabled = true;
+#else
+    static constexpr bool if_enabled = false;
+#endif
+
+private:
+    struct Block {
+        std::array<std::atomic<std::uint64_t>, CounterSnapshot::num_of_counters> Values = {};
+
+        CounterSnapshot load() const {
+            CounterSnapshot res;
+            for (size_t index = 0; index < CounterSnapshot::num_of_counters; ++index) {
+                res.values[index] = Values[index].load(std::memory_order_relaxed);
+            }
+            return res;
+        }
+    };
+    struct Registry {
+        std::mutex          Lock;
+        std::vector<Block*> Blocks;
+        CounterSnapshot     Retired; // of the threads which have exited
+    };
+    static Registry& return_registry() {
+        static Registry res;
+        return res;
+    }
+    /// @brief the block of the calling thread, registered on first use
+    struct LocalBlock {
+        Block Data;
+
+        LocalBlock() {
+            Registry&                   registry = return_registry();
+            std::lock_guard<std::mutex> guard(registry.Lock);
+            registry.Blocks.push_back(&Data);
+        }
+        ~LocalBlock() {
+            Registry&                   registry = return_registry();
+            std::lock_guard<std::mutex> guard(registry.Lock);
+            registry.Retired += Data.load();
+            registry.Blocks.erase(std::find(registry.Blocks.begin(), registry.Blocks.end(), &Data));
+        }
+    };
+    static Block& return_local_block() {
+        thread_local LocalBlock res;
+        return res.Data;
+    }
+
+public:
+    HotPathCounters() = delete;
+
+    static void add(HotPathCounter counter, std::uint64_t value = 1) {
+        if constexpr (if_enabled) {
+            auto& slot = return_local_block().Values[static_cast<size_t>(counter)];
+            slot.store(slot.load(std::memory_order_relaxed) + value, std::memory_order_relaxed);
+        }
+    }
+
+    /// @brief counters of the @b calling thread (all `0` if disabled)
+    static CounterSnapshot return_thread_snapshot() {
+        if constexpr (if_enabled) {
+            return return_local_block().load();
+        }
+        return {};
+    }
+    /// @brief counters of @b all threads (all `0` if disabled)
+    static CounterSnapshot return_global_snapshot() {
+        if constexpr (if_enabled) {
+            Registry&                   registry = return_registry();
+            std::lock_guard<std::mutex> guard(registry.Lock);
+            CounterSnapshot             res = registry.Retired;
+            for (auto&& block : registry.Blocks) {
+                res += block->load();
+            }
+            return res;
+        }
+        return {};
+    }
+};
+
+} // namespace Tool
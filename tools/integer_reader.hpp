@@ -0,0 +1,211 @@
+/**
+ * @file integer_reader.hpp
+ * @author Eden (edwardwang33773@gmail.com)
+ * @brief Read integers from a stream in @b big_chunks , decoded by @b std::from_chars
+ * @note
+        `std::cin >> tmp` goes through @b sentry , @b locale and @b num_get for @p every number.
+        Here =>
+            1. |-> bytes are pulled by @b sgetn into a buffer ( @b 1MiB by default),
+                   an unfinished token is moved to the front before the next chunk
+            2. |-> whitespace is skipped by a plain loop, a token is decoded by
+                   @b std::from_chars (no locale, no allocation)
+            3. |-> the @b line / @b column of each token are tracked,
+                   so a bad token is reported where it is
+
+        @b by_line => refill with @b one_line at a time, for an @p interactive terminal
+                      (a chunk read would block until the buffer is full)
+ * @version 0.1
+ * @date 2022-10-28
+ *
+ * @copyright Copyright (c) 2022
+ *
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <charconv>
+#include <concepts>
+#include <cstring>
+#include <istream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <vector>
+
+namespace Tool {
+
+class IntegerReader {
+public:
+    enum class Refill : unsigned short {
+        by_chunk = 0,
+        by_line  = 1,
+    };
+
+    static constexpr size_t default_chunk_size = size_t { 1 } << 20;
+    static constexpr size_t max_token_size     = 64; // longer => not a number for sure
+
+private:
+    std::istream&     Input;
+    Refill            Mode;
+    std::vector<char> Buffer;
+    size_t            Begin  = 0; // next unread byte
+    size_t            End    = 0; // end of valid bytes
+    bool              if_eof = false;
+
+    size_t Line   = 1; // of Buffer[Begin]
+    size_t Column = 1;
+
+    size_t TokenLine   = 0; // of the last token
+    size_t TokenColumn = 0;
+
+    /// @brief keep [Begin, End) , append more bytes, @b false if nothing more could be read
+    bool refill() {
+        if (if_eof) {
+            return false;
+        }
+        std::memmove(Buffer.data(), Buffer.data() + Begin, End - Begin);
+        End -= Begin;
+        Begin = 0;
+
+        size_t num_of_read = 0;
+        if (Mode == Refill::by_chunk) {
+            num_of_read = Input.rdbuf()->sgetn(Buffer.data() + End, Buffer.size() - End);
+        } else {
+            std::string line;
+            if (std::getline(Input, line)) {
+                line += '\n';
+                if (End + line.size() > Buffer.size()) {
+                    Buffer.resize(End + line.size());
+                }
+                std::memcpy(Buffer.data() + End, line.data(), line.size());
+                num_of_read = line.size();
+            }
+        }
+        if (num_of_read == 0) {
+            if_eof = true;
+            Input.setstate(std::ios::eofbit);
+            return false;
+        }
+        End += num_of_read;
+        return true;
+    }
+
+    static constexpr bool if_space(char ch) {
+        return ch == ' ' || ch == '\n' || ch == '\t' || ch == '\r' || ch == '\v' || ch == '\f';
+    }
+
+    /// @brief @b false at the end of input, or ( @b !if_cross_line ) at a line break
+    bool skip_space(bool if_cross_line) {
+        while (true) {
+            if (Begin == End && !refill()) {
+                return false;
+            }
+            char ch = Buffer[Begin];
+            if (!if_space(ch)) {
+                return true;
+            }
+            if (ch == '\n') {
+                if (!if_cross_line) {
+                    return false;
+                }
+                ++Line;
+                Column = 1;
+            } else {
+                ++Column;
+            }
+            ++Begin;
+        }
+    }
+
+    template <std::integral T>
+    void read_token(T& value) {
+        TokenLine   = Line;
+        TokenColumn = Column;
+
+        // 1. the whole token should be in the buffer
+        size_t token_end = Begin;
+        while (true) {
+            while (token_end < End && !if_space(Buffer[token_end])) {
+                ++token_end;
+            }
+            if (token_end < End || token_end - Begin > max_token_size) {
+                break;
+            }
+            size_t offset  = token_end - Begin;
+            bool   if_more = refill();
+            token_end      = Begin + offset; // [Begin, End) has been moved to the front
+            if (!if_more) {
+                break;
+            }
+        }
+        const char* first = Buffer.data() + Begin;
+        const char* last  = Buffer.data() + token_end;
+        if (token_end - Begin > max_token_size) {
+            throw_at_token(std::string(first, max_token_size) + "...", "is not a number. ");
+        }
+
+        // 2. decode
+        auto [ptr, error] = std::from_chars(first, last, value);
+        if (error == std::errc::result_out_of_range) {
+            throw_at_token(std::string_view(first, last), "is out of range. ");
+        }
+        if (error != std::errc {} || ptr != last) {
+            throw_at_token(std::string_view(first, last), "is not a number. ");
+        }
+        Column += token_end - Begin;
+        Begin = token_end;
+    }
+
+    [[noreturn]] void throw_at_token(std::string_view token, std::string_view what) const {
+        throw std::logic_error(
+            "line " + std::to_string(TokenLine)
+            + ", column " + std::to_string(TokenColumn)
+            + ": `" + std::string(token) + "` " + std::string(what)
+        );
+    }
+
+public:
+    explicit IntegerReader(
+        std::istream& input,
+        Refill        mode       = Refill::by_chunk,
+        size_t        chunk_size = default_chunk_size
+    )
+        : Input(input)
+        , Mode(mode)
+        , Buffer(std::max(chunk_size, 2 * max_token_size)) { }
+
+    /**
+     * @brief read the next integer
+     * @return @b false if there's nothing but whitespace till the end
+     * @exception std::logic_error "line L, column C: `token` is not a number / is out of range"
+     */
+    template <std::integral T>
+    bool read(T& value) {
+        if (!skip_space(true)) {
+            return false;
+        }
+        read_token(value);
+        return true;
+    }
+    /// @brief the same, but @b false if the current line ends first (the line break is @p not_consumed )
+    template <std::integral T>
+    bool read_in_line(T& value) {
+        if (!skip_space(false)) {
+            return false;
+        }
+        read_token(value);
+        return true;
+    }
+
+    /// @brief position of the last token (from `1`)
+    size_t return_line() const {
+        return TokenLine;
+    }
+    size_t return_column() const {
+        return TokenColumn;
+    }
+};
+
+} // namespace Tool
@@ -0,0 +1,243 @@
+/**
+ * @file linear_hierholzer.hpp
+ * @author Eden (edwardwang33773@gmail.com)
+ * @brief Hierholzer Algorithm, @b truly T(n) = O( V + E ) , on any @b GraphView
+ * @note
+        1). |
+            |-> @p load => flatten the @b GraphView into per-vertex edge lists (CSR),
+                each @b multi_edge is expanded into @b several_slots ,
+                an @e undirected edge is shared by both endpoints through its @b edge_id
+        2). |
+            |-> @p run  => every vertex keeps a @b pointer to its next unused slot,
+                so each slot is visited @b once , no more row rescans.
+                @e undirected => an @b edge_used_bitmap replaces the
+                    symmetric double decrements on the matrix
+        3). |
+            |-> @p start / @p advance => the same walk, @b N steps at a time,
+                so a long traversal never blocks its caller (see @b advance )
+
+        Vertices of the result are written into a @b pre_reserved
+        `TrackedVector<uint32_t>` , and all buffers are kept between calls,
+        so one @b LinearHierholzer could be reused as @b scratch for many graphs.
+        Buffers are @b tracked ( @e memory_tracking.hpp ) => charged to the query which grows them.
+ * @version 0.1
+ * @date 2022-10-23
+ *
+ * @copyright Copyright (c) 2022
+ *
+ */
+
+#pragma once
+
+#include "graph_view.hpp"
+#include "hot_path_counters.hpp"
+#include "memory_tracking.hpp"
+#include "trace_events.hpp"
+#include <algorithm>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace Tool {
+
+class LinearHierholzer {
+    bool   if_directed  = true;
+    size_t num_of_nodes = 0;
+    size_t num_of_edges = 0;
+
+    TrackedVector<size_t>        EdgeBegin;  // EdgeBegin[vertex] .. EdgeBegin[vertex + 1] => slots of `vertex`
+    TrackedVector<std::uint32_t> EdgeTarget; // EdgeTarget[slot] => the other endpoint
+    TrackedVector<std::uint32_t> EdgeId;     // EdgeId[slot] => edge id, @e undirected only
+    TrackedVector<size_t>        NextSlot;   // NextSlot[vertex] => first slot which may be unused
+    TrackedVector<std::uint64_t> EdgeUsed;   // bitmap of edge id, @e undirected only
+
+    TrackedVector<std::uint32_t> Stack;
+    TrackedVector<std::uint32_t> Circuit;
+    size_t                       NumOf_WalkedEdges = 0;
+
+    constexpr bool if_used(std::uint32_t edge_id) {
+        return (EdgeUsed[edge_id / 64] >> (edge_id % 64)) & 1;
+    }
+    constexpr void set_used(std::uint32_t edge_id) {
+        EdgeUsed[edge_id / 64] |= std::uint64_t { 1 } << (edge_id % 64);
+    }
+
+public:
+    LinearHierholzer() = default;
+
+    /**
+     * @brief flatten the @b GraphView into edge lists, T(n) = O( V + E ) iterations
+     * @note the view itself is @p not_modified
+     */
+    template <GraphView G>
+    void load(G& graph) {
+        if_directed  = G::if_directed;
+        num_of_nodes = graph.return_num_of_nodes();
+
+        // 1. count slots of each vertex
+        EdgeBegin.assign(num_of_nodes + 2, 0);
+        for (size_t vertex = 1; vertex <= num_of_nodes; ++vertex) {
+            for (size_t col = graph.return_first_iterable(vertex);
+                 col != 0;
+                 col = graph.return_next_iterable(vertex, col)) {
+                size_t multiplicity = graph.return_multiplicity(vertex, col);
+                if constexpr (G::if_directed) {
+                    EdgeBegin[vertex + 1] += multiplicity;
+                } else {
+                    if (col < vertex) {
+                        continue; // has been counted from the other side
+                    }
+                    EdgeBegin[vertex + 1] += multiplicity;
+                    if (col != vertex) {
+                        EdgeBegin[col + 1] += multiplicity;
+                    }
+                }
+            }
+        }
+        for (size_t vertex = 1; vertex <= num_of_nodes + 1; ++vertex) {
+            EdgeBegin[vertex] += EdgeBegin[vertex - 1];
+        }
+        size_t num_of_slots = EdgeBegin[num_of_nodes + 1];
+
+        // 2. fill slots
+        EdgeTarget.resize(num_of_slots);
+        NextSlot.assign(EdgeBegin.begin(), EdgeBegin.end() - 1);
+        if constexpr (!G::if_directed) {
+            EdgeId.resize(num_of_slots);
+        }
+        num_of_edges = 0;
+        for (size_t vertex = 1; vertex <= num_of_nodes; ++vertex) {
+            for (size_t col = graph.return_first_iterable(vertex);
+                 col != 0;
+                 col = graph.return_next_iterable(vertex, col)) {
+                size_t multiplicity = graph.return_multiplicity(vertex, col);
+                if constexpr (G::if_directed) {
+                    for (size_t i = 0; i < multiplicity; ++i) {
+                        EdgeTarget[NextSlot[vertex]++] = col;
+                    }
+                    num_of_edges += multiplicity;
+                } else {
+                    if (col < vertex) {
+                        continue;
+                    }
+                    for (size_t i = 0; i < multiplicity; ++i) {
+                        EdgeTarget[NextSlot[vertex]] = col;
+                        EdgeId[NextSlot[vertex]++]   = num_of_edges;
+                        if (col != vertex) {
+                            EdgeTarget[NextSlot[col]] = vertex;
+                            EdgeId[NextSlot[col]++]   = num_of_edges;
+                        }
+                        ++num_of_edges;
+                    }
+                }
+            }
+        }
+    }
+
+    /**
+     * @brief walk the euler circle from `vertex` , T(n) = O( V + E )
+     * @attention the loaded graph @p must_have an euler circle (check it ahead)
+     * @return vertices of the circle ( @b first == @b last == `vertex` ),
+     *         it's an internal buffer, valid until next @p load / @p run
+     */
+    TrackedVector<std::uint32_t>& run(std::uint32_t vertex) {
+        TraceSpan span("hierholzer_linear", "construction");
+        start(vertex);
+        advance(3 * num_of_edges + 1); // enough for any graph, see @b advance
+        return Circuit;
+    }
+
+    /**
+     * @brief @b step_wise walk => the same circle as @p run , but @b resumable
+     * @note
+            @b start(vertex)   => reset, nothing is walked yet
+            @b advance(N)      => at most @b N steps, then return (the progress is kept)
+                                  @b step => walk @b one edge ahead, settle @b one vertex of the circle,
+                                  or skip @b one slot passed from the other side ( @e undirected ),
+                                  so a circle of @b E edges takes exactly `2 * E + 1` steps if @e directed ,
+                                  at most `3 * E + 1` if @e undirected => one call is @b O(N) , strictly
+            @b if_finished()   => then @b return_circle() is the circle ( @b first == @b last == `vertex` )
+
+            Partial state, valid until next @p advance =>
+                @b return_num_of_walked_edges() => edges walked ahead, in [0, E]
+                @b return_trail()   => the open trail, from `vertex` to where it is now
+                @b return_settled() => the settled @b tail of the circle, in the @b reversed order
+                                       (once finished => the whole circle, in order)
+
+            Each @b LinearHierholzer keeps its own state => many of them could be @b interleaved
+            on one thread (e.g. a few steps each per loop), none of them blocks the others.
+     */
+    void start(std::uint32_t vertex) {
+        NextSlot.assign(EdgeBegin.begin(), EdgeBegin.end() - 1);
+        if (!if_directed) {
+            EdgeUsed.assign((num_of_edges + 63) / 64, 0);
+        }
+        Stack.clear();
+        Stack.reserve(num_of_edges + 1);
+        Circuit.clear();
+        Circuit.reserve(num_of_edges + 1);
+        NumOf_WalkedEdges = 0;
+
+        Stack.push_back(vertex);
+    }
+    /// @return num of steps done, `< max_num_of_steps` => finished
+    size_t advance(size_t max_num_of_steps) {
+        size_t num_of_steps  = 0;
+        size_t walked_before = NumOf_WalkedEdges;
+        while (!Stack.empty() && num_of_steps < max_num_of_steps) {
+            ++num_of_steps;
+            std::uint32_t curr_vertex = Stack.back();
+            size_t&       curr_slot   = NextSlot[curr_vertex];
+            size_t        end_slot    = EdgeBegin[curr_vertex + 1];
+            if (!if_directed && curr_slot < end_slot && if_used(EdgeId[curr_slot])) {
+                ++curr_slot; // has been passed from the other side
+                continue;
+            }
+            if (curr_slot < end_slot) {
+                // curr_vertex is not alone, go ahead
+                if (!if_directed) {
+                    set_used(EdgeId[curr_slot]);
+                }
+                Stack.push_back(EdgeTarget[curr_slot]);
+                ++curr_slot;
+                ++NumOf_WalkedEdges;
+            } else {
+                // curr_vertex is alone, that means we've found a ring
+                Circuit.push_back(curr_vertex);
+                Stack.pop_back();
+                if (Stack.empty()) {
+                    // vertices are popped in the reversed order
+                    std::reverse(Circuit.begin(), Circuit.end());
+                }
+            }
+        }
+
+        HotPathCounters::add(HotPathCounter::traversal_steps, NumOf_WalkedEdges - walked_before);
+        return num_of_steps;
+    }
+    bool if_finished() const {
+        return Stack.empty();
+    }
+    size_t return_num_of_walked_edges() const {
+        return NumOf_WalkedEdges;
+    }
+    std::span<const std::uint32_t> return_trail() const {
+        return Stack;
+    }
+    std::span<const std::uint32_t> return_settled() const {
+        return Circuit;
+    }
+    /// @attention only if @b if_finished()
+    TrackedVector<std::uint32_t>& return_circle() {
+        return Circuit;
+    }
+
+    constexpr size_t return_num_of_nodes() {
+        return num_of_nodes;
+    }
+    constexpr size_t return_num_of_edges() {
+        return num_of_edges;
+    }
+};
+
+} // namespace Tool
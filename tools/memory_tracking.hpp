@@ -0,0 +1,184 @@
+/**
+ * @file memory_tracking.hpp
+ * @author Eden (edwardwang33773@gmail.com)
+ * @brief TrackingAllocator + MemoryScope => @b how_much memory a query takes, and an optional @b cap
+ * @note
+        @b TrackingAllocator is @p stateless (so containers move / swap as with @b std::allocator ),
+        each allocation is charged to the @b MemoryScope of the @b calling_thread (if any) =>
+
+            @b live_bytes          => allocated - freed, inside the scope
+            @b peak_bytes          => max of @b live_bytes
+            @b num_of_allocations  => allocations inside the scope
+            @b num_of_bytes        => bytes of them (freed or not)
+
+        Scopes could be @b nested , an allocation is charged to the scope @b and all its parents.
+        A scope is opened on @b one thread, but a @b MemoryScopeBinding lets the workers of a query
+        charge it too (its counters are @b atomic ), e.g. the threads of @e ParallelHierholzer .
+        @b cap ( @p 0 => none) => an allocation which would bring @b live_bytes over the cap of
+        any scope throws @b MemoryCapExceeded @p before anything is allocated, so the query
+        unwinds as from any other exception, and no memory is leaked.
+
+        Used by @e Tool::Matrix (so by the @b graphs and all matrices of @b Fleury ),
+        @e DenseGraphView / @e AdjacencyBitset , @e SparseGraph (CSR), the buffers of
+        @e LinearHierholzer / @e ParallelHierholzer , the paths of @b H / @b H_fastest / @b F ,
+        and the circle of an @e EulerResult / @e EulerCircleSet .
+        A @b scratch buffer which is reused is only charged to the query which @b grows it.
+        Memory freed in a scope but allocated @b before it makes @b live_bytes negative,
+        @b peak_bytes is not affected.
+
+        Usage =>
+            Tool::MemoryScope scope(64 << 20); // 64 MiB
+            auto res = graph::return_an_euler_circle_F(input, 1);
+            scope.return_usage().peak_bytes;
+ * @version 0.1
+ * @date 2022-10-28
+ *
+ * @copyright Copyright (c) 2022
+ *
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace Tool {
+
+class MemoryCapExceeded : public std::logic_error {
+public:
+    using std::logic_error::logic_error;
+};
+
+struct MemoryUsage {
+    std::int64_t live_bytes         = 0;
+    std::int64_t peak_bytes         = 0;
+    size_t       num_of_allocations = 0;
+    size_t       num_of_bytes       = 0;
+};
+
+class MemoryScope {
+    MemoryScope*              Parent;
+    size_t                    Cap; // 0 => no cap
+    std::atomic<std::int64_t> LiveBytes         = 0;
+    std::atomic<std::int64_t> PeakBytes         = 0;
+    std::atomic<size_t>       NumOf_Allocations = 0;
+    std::atomic<size_t>       NumOf_Bytes       = 0;
+
+    static inline thread_local MemoryScope* Curr = nullptr;
+
+    friend class MemoryScopeBinding;
+
+public:
+    explicit MemoryScope(size_t cap = 0)
+        : Parent(Curr)
+        , Cap(cap) {
+        Curr = this;
+    }
+    MemoryScope(const MemoryScope&)            = delete;
+    MemoryScope& operator=(const MemoryScope&) = delete;
+    ~MemoryScope() {
+        Curr = Parent;
+    }
+
+    MemoryUsage return_usage() const {
+        return {
+            LiveBytes.load(std::memory_order_relaxed),
+            PeakBytes.load(std::memory_order_relaxed),
+            NumOf_Allocations.load(std::memory_order_relaxed),
+            NumOf_Bytes.load(std::memory_order_relaxed)
+        };
+    }
+    size_t return_cap() const {
+        return Cap;
+    }
+    /// @brief innermost scope of the calling thread, @b nullptr if none
+    static MemoryScope* return_current() {
+        return Curr;
+    }
+
+    /// @exception MemoryCapExceeded if any scope would go over its cap (nothing is charged then)
+    static void on_allocate(size_t bytes) {
+        if (!Curr) {
+            return;
+        }
+        auto signed_bytes = static_cast<std::int64_t>(bytes);
+        // charged first, then checked => concurrent allocations never pass the cap together
+        for (MemoryScope* scope = Curr; scope; scope = scope->Parent) {
+            std::int64_t live = scope->LiveBytes.fetch_add(signed_bytes, std::memory_order_relaxed) + signed_bytes;
+            if (scope->Cap != 0 && live > static_cast<std::int64_t>(scope->Cap)) {
+                for (MemoryScope* charged = Curr; charged != scope->Parent; charged = charged->Parent) {
+                    charged->LiveBytes.fetch_sub(signed_bytes, std::memory_order_relaxed);
+                }
+                throw MemoryCapExceeded(
+                    "Memory cap exceeded: " + std::to_string(bytes) + " more bytes over "
+                    + std::to_string(live - signed_bytes) + " live bytes, cap is "
+                    + std::to_string(scope->Cap) + " bytes. "
+                );
+            }
+        }
+        for (MemoryScope* scope = Curr; scope; scope = scope->Parent) {
+            std::int64_t live = scope->LiveBytes.load(std::memory_order_relaxed);
+            std::int64_t peak = scope->PeakBytes.load(std::memory_order_relaxed);
+            while (live > peak && !scope->PeakBytes.compare_exchange_weak(peak, live, std::memory_order_relaxed)) { }
+            scope->NumOf_Allocations.fetch_add(1, std::memory_order_relaxed);
+            scope->NumOf_Bytes.fetch_add(bytes, std::memory_order_relaxed);
+        }
+    }
+    static void on_deallocate(size_t bytes) {
+        for (MemoryScope* scope = Curr; scope; scope = scope->Parent) {
+            scope->LiveBytes.fetch_sub(static_cast<std::int64_t>(bytes), std::memory_order_relaxed);
+        }
+    }
+};
+
+/// @brief charge allocations of the @b calling_thread to `scope` (opened on another thread), until it's destroyed
+/// @attention `scope` @p must_outlive the binding => bind it in workers which are joined before it's closed
+class MemoryScopeBinding {
+    MemoryScope* Prev;
+
+public:
+    explicit MemoryScopeBinding(MemoryScope* scope)
+        : Prev(MemoryScope::Curr) {
+        MemoryScope::Curr = scope;
+    }
+    MemoryScopeBinding(const MemoryScopeBinding&)            = delete;
+    MemoryScopeBinding& operator=(const MemoryScopeBinding&) = delete;
+    ~MemoryScopeBinding() {
+        MemoryScope::Curr = Prev;
+    }
+};
+
+template <typename T>
+class TrackingAllocator {
+public:
+    using value_type = T;
+
+    TrackingAllocator() noexcept = default;
+    template <typename U>
+    TrackingAllocator(const TrackingAllocator<U>&) noexcept { }
+
+    T* allocate(size_t num) {
+        MemoryScope::on_allocate(num * sizeof(T));
+        return std::allocator<T>().allocate(num);
+    }
+    void deallocate(T* ptr, size_t num) noexcept {
+        MemoryScope::on_deallocate(num * sizeof(T));
+        std::allocator<T>().deallocate(ptr, num);
+    }
+
+    template <typename U>
+    bool operator==(const TrackingAllocator<U>&) const noexcept {
+        return true;
+    }
+};
+
+template <typename T>
+using TrackedVector = std::vector<T, TrackingAllocator<T>>;
+
+} // namespace Tool
@@ -0,0 +1,158 @@
+/**
+ * @file parallel_euler_circle_enumerator.hpp
+ * @author Eden (edwardwang33773@gmail.com)
+ * @brief Enumerate @b all distinct euler circles from a vertex, on a @b work_stealing thread pool
+ * @note
+        The search tree of @e EulerCircleEnumerator is @b split at its shallow
+        @b branching_levels (forced moves don't count) =>
+
+        1. |-> a @b task is a @b prefix (slots taken from the start vertex)
+        2. |-> the worker running it @b replays the prefix on its @b private copy of the
+               adjacency, then walks forced moves until a branching point
+        3. |-> above `num_of_split_levels` => every feasible branch becomes a @b new_task
+               (pushed into the worker's own deque, @b stolen by idle workers)
+               otherwise          => the subtree is enumerated @b sequentially
+
+        Each circle is handed to a @b callback with the @b worker_index ,
+        so output could be @b sharded per worker without any lock.
+ * @version 0.1
+ * @date 2022-10-27
+ *
+ * @copyright Copyright (c) 2022
+ *
+ */
+
+#pragma once
+
+#include "euler_circle_enumerator.hpp"
+#include "graph_view.hpp"
+#include "thread_pool.hpp"
+#include <bit>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <span>
+#include <vector>
+
+namespace Tool {
+
+class ParallelEulerCircleEnumerator {
+public:
+    /// @brief called @b concurrently by different workers, @b serially by the same one
+    using callback_type = std::function<void(size_t worker_index, std::span<const std::uint32_t> circle)>;
+
+    struct Report {
+        size_t num_of_circles = 0;
+        size_t num_of_tasks   = 0;
+        size_t num_of_threads = 0;
+        double seconds        = 0;
+
+        double return_circles_per_second() const {
+            return seconds > 0 ? num_of_circles / seconds : 0;
+        }
+        double return_circles_per_second_per_core() const {
+            return num_of_threads > 0 ? return_circles_per_second() / num_of_threads : 0;
+        }
+    };
+
+private:
+    struct alignas(64) Counter {
+        size_t num_of_circles = 0;
+        size_t num_of_tasks   = 0;
+    };
+
+    ThreadPool&                        Pool;
+    EulerCircleEnumerator              Prototype;
+    std::vector<EulerCircleEnumerator> Engines;  // Engines[worker_index] => private copy
+    std::vector<std::vector<size_t>>   Options;  // Options[worker_index] => scratch
+    std::vector<Counter>               Counters; // Counters[worker_index]
+
+    void run_task(
+        std::uint32_t        vertex,
+        std::vector<size_t>  prefix,
+        size_t               level,
+        size_t               num_of_split_levels,
+        const callback_type& on_circle
+    ) {
+        size_t                 worker_index = Pool.return_worker_index();
+        EulerCircleEnumerator& engine       = Engines[worker_index];
+        std::vector<size_t>&   options      = Options[worker_index];
+        Counter&               counter      = Counters[worker_index];
+        ++counter.num_of_tasks;
+
+        engine.reset(vertex);
+        for (auto&& slot : prefix) {
+            engine.take(slot);
+        }
+        while (!engine.if_complete()) {
+            engine.return_options(options);
+            if (options.size() == 1) {
+                engine.take(options.front()); // forced
+                continue;
+            }
+            if (level < num_of_split_levels) {
+                auto taken = engine.return_taken();
+                for (auto&& slot : options) {
+                    std::vector<size_t> child(taken.begin(), taken.end());
+                    child.push_back(slot);
+                    Pool.submit([this, vertex, child = std::move(child), level, num_of_split_levels, &on_circle]() mutable {
+                        run_task(vertex, std::move(child), level + 1, num_of_split_levels, on_circle);
+                    });
+                }
+                return;
+            }
+            for (auto&& circle : engine.run_subtree()) {
+                on_circle(worker_index, circle);
+                ++counter.num_of_circles;
+            }
+            return;
+        }
+        on_circle(worker_index, engine.return_path());
+        ++counter.num_of_circles;
+    }
+
+public:
+    explicit ParallelEulerCircleEnumerator(ThreadPool& inputPool)
+        : Pool(inputPool) { }
+
+    /// @brief the view itself is @p not_modified
+    template <GraphView G>
+    void load(G& graph) {
+        Prototype.load(graph);
+        Engines.assign(Pool.return_num_of_threads(), Prototype);
+        Options.assign(Pool.return_num_of_threads(), {});
+    }
+
+    /**
+     * @brief enumerate @b all circles from `vertex`
+     * @attention the loaded graph @p must_have an euler circle (check it ahead)
+     * @param num_of_split_levels `0` => about 8 tasks per thread
+     */
+    Report run(std::uint32_t vertex, const callback_type& on_circle, size_t num_of_split_levels = 0) {
+        Report res;
+        res.num_of_threads = Pool.return_num_of_threads();
+        if (!Prototype.reset(vertex)) {
+            return res;
+        }
+        if (num_of_split_levels == 0) {
+            num_of_split_levels = std::bit_width(8 * res.num_of_threads - 1);
+        }
+        Counters.assign(res.num_of_threads, {});
+
+        auto begin = std::chrono::steady_clock::now();
+        Pool.submit([this, vertex, num_of_split_levels, &on_circle] {
+            run_task(vertex, {}, 0, num_of_split_levels, on_circle);
+        });
+        Pool.wait();
+        auto end = std::chrono::steady_clock::now();
+
+        res.seconds = std::chrono::duration<double>(end - begin).count();
+        for (auto&& counter : Counters) {
+            res.num_of_circles += counter.num_of_circles;
+            res.num_of_tasks += counter.num_of_tasks;
+        }
+        return res;
+    }
+};
+
+} // namespace Tool
@@ -0,0 +1,411 @@
+/**
+ * @file parallel_hierholzer.hpp
+ * @author Eden (edwardwang33773@gmail.com)
+ * @brief Euler circle of a very large graph, built by @b several_threads
+ * @note
+        Each edge has two @b ends ( @b end = 2 * edge_id + 0 => tail, + 1 => head ).
+        If we @b pair the ends at each vertex ( @e directed => one @b in_end with one @b out_end ),
+        then `arrived_end -> Partner[arrived_end] ^ 1` walks the graph, and the edges are
+        split into @b closed_sub_trails . Then =>
+
+        1). |-> @p pair    => ends at each vertex are paired,                 @b parallel by vertex
+        2). |-> @p label   => each thread walks sub-trails from its edges,
+                              claiming edges by @b CAS , walks which bump
+                              into each other are @b unioned later,           @b parallel by edge ( @b lock_free )
+        3). |-> @p splice  => at a shared vertex, @b swapping the partners of
+                              two ends of different sub-trails merges them
+                              into one (union-find keeps which is which),     @b sequential , O( E * α )
+        4). |-> @p emit    => the circle is cut at some @b splitter_edges ,
+                              each segment is walked into its own buffer,
+                              then copied to its offset ( @b list_ranking ), @b parallel by segment
+
+        The final circle is @b valid , but (unlike @e LinearHierholzer ) the order
+        depends on the thread scheduling.
+
+        All storage is @b tracked ( @e memory_tracking.hpp ), workers are @b bound to the
+        @b MemoryScope of the calling thread, so their buffers are charged to it as well.
+ * @version 0.1
+ * @date 2022-10-25
+ *
+ * @copyright Copyright (c) 2022
+ *
+ */
+
+#pragma once
+
+#include "graph_view.hpp"
+#include "memory_tracking.hpp"
+#include "trace_events.hpp"
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <exception>
+#include <mutex>
+#include <numeric>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace Tool {
+
+class ParallelHierholzer {
+    using end_t = std::uint64_t;
+
+    static constexpr std::uint32_t unlabeled = static_cast<std::uint32_t>(-1);
+
+    bool   if_directed    = true;
+    size_t num_of_nodes   = 0;
+    size_t num_of_edges   = 0;
+    size_t num_of_threads = 1;
+
+    TrackedVector<std::uint32_t> Tail; // Tail[edge]
+    TrackedVector<std::uint32_t> Head; // Head[edge]
+
+    TrackedVector<size_t> EndBegin; // EndBegin[vertex] .. EndBegin[vertex + 1] => ends at `vertex`
+    TrackedVector<end_t>  EndsAt;
+    TrackedVector<end_t>  Partner; // Partner[end] => the paired end at the same vertex
+
+    TrackedVector<std::uint32_t> Label; // Label[edge] => id of the walk claiming it, @b atomic_ref
+    TrackedVector<std::uint32_t> TrailOf;
+
+    TrackedVector<std::uint32_t> Circuit;
+
+    template <typename Func>
+    void run_in_parallel(Func&& func) {
+        std::vector<std::thread> workers;
+        workers.reserve(num_of_threads - 1);
+        MemoryScope*       scope = MemoryScope::return_current();
+        std::exception_ptr error; // the first one, rethrown after all threads are joined
+        std::mutex         error_mutex;
+        auto               traced = [&](size_t thread_index) {
+            MemoryScopeBinding binding(scope);
+            TraceSpan          span("parallel_chunk", "construction");
+            try {
+                func(thread_index);
+            } catch (...) {
+                std::lock_guard lock(error_mutex);
+                if (!error) {
+                    error = std::current_exception();
+                }
+            }
+        };
+        for (size_t thread_index = 1; thread_index < num_of_threads; ++thread_index) {
+            workers.emplace_back(traced, thread_index);
+        }
+        traced(size_t { 0 });
+        for (auto&& worker : workers) {
+            worker.join();
+        }
+        if (error) {
+            std::rethrow_exception(error);
+        }
+    }
+    /// @brief [begin, end) of the `thread_index`-th chunk of [0, total)
+    std::pair<size_t, size_t> return_chunk(size_t total, size_t thread_index) {
+        return {
+            total * thread_index / num_of_threads,
+            total * (thread_index + 1) / num_of_threads
+        };
+    }
+    constexpr std::uint32_t return_vertex_of(end_t end) {
+        return (end & 1) ? Head[end >> 1] : Tail[end >> 1];
+    }
+    static size_t find_root(TrackedVector<std::uint32_t>& parent, size_t id) {
+        while (parent[id] != id) {
+            parent[id] = parent[parent[id]];
+            id         = parent[id];
+        }
+        return id;
+    }
+
+    /// @brief 1). build ends of each vertex, then pair them
+    void pair_ends() {
+        TrackedVector<size_t> cursor(num_of_nodes + 2, 0); // @b atomic_ref
+        auto                  fetch_add = [&cursor](size_t vertex) {
+            return std::atomic_ref<size_t>(cursor[vertex]).fetch_add(1, std::memory_order_relaxed);
+        };
+        run_in_parallel([&](size_t thread_index) {
+            auto [begin, end] = return_chunk(num_of_edges, thread_index);
+            for (size_t edge = begin; edge < end; ++edge) {
+                fetch_add(Tail[edge] + 1);
+                fetch_add(Head[edge] + 1);
+            }
+        });
+        EndBegin.assign(num_of_nodes + 2, 0);
+        for (size_t vertex = 1; vertex <= num_of_nodes + 1; ++vertex) {
+            EndBegin[vertex] = EndBegin[vertex - 1] + cursor[vertex];
+            cursor[vertex]   = EndBegin[vertex - 1];
+        }
+        EndsAt.resize(2 * num_of_edges);
+        Partner.resize(2 * num_of_edges);
+        run_in_parallel([&](size_t thread_index) {
+            auto [begin, end] = return_chunk(num_of_edges, thread_index);
+            for (size_t edge = begin; edge < end; ++edge) {
+                EndsAt[fetch_add(Tail[edge] + 1)] = 2 * edge;
+                EndsAt[fetch_add(Head[edge] + 1)] = 2 * edge + 1;
+            }
+        });
+
+        run_in_parallel([&](size_t thread_index) {
+            auto [begin, end] = return_chunk(num_of_nodes, thread_index);
+            for (size_t vertex = begin + 1; vertex <= end; ++vertex) {
+                end_t* first = EndsAt.data() + EndBegin[vertex];
+                end_t* last  = EndsAt.data() + EndBegin[vertex + 1];
+                if (if_directed) {
+                    // in_ends (odd) first, then out_ends (even), i-th in <=> i-th out
+                    std::partition(first, last, [](end_t curr) { return (curr & 1) == 1; });
+                    size_t half = (last - first) / 2;
+                    for (size_t i = 0; i < half; ++i) {
+                        Partner[first[i]]        = first[half + i];
+                        Partner[first[half + i]] = first[i];
+                    }
+                } else {
+                    for (end_t* curr = first; curr + 1 < last; curr += 2) {
+                        Partner[curr[0]] = curr[1];
+                        Partner[curr[1]] = curr[0];
+                    }
+                }
+            }
+        });
+    }
+
+    /// @brief 2). label closed sub-trails, lock-free
+    void label_sub_trails() {
+        Label.assign(num_of_edges, unlabeled);
+        auto label_of = [this](size_t edge) {
+            return std::atomic_ref<std::uint32_t>(Label[edge]);
+        };
+
+        // links[thread] => { walk, another walk it bumped into }
+        TrackedVector<TrackedVector<std::pair<std::uint32_t, std::uint32_t>>> links(num_of_threads);
+        // @e undirected => a walk may run @b against the others on the same sub-trail,
+        // so it goes both ways from its first edge, to bump into both neighbors
+        run_in_parallel([&](size_t thread_index) {
+            auto [begin, end] = return_chunk(num_of_edges, thread_index);
+            for (size_t edge = begin; edge < end; ++edge) {
+                std::uint32_t walk     = edge;
+                std::uint32_t expected = unlabeled;
+                if (!label_of(edge).compare_exchange_strong(expected, walk)) {
+                    continue;
+                }
+                for (end_t arrived_first : { end_t { 2 * edge + 1 }, end_t { 2 * edge } }) {
+                    end_t arrived = arrived_first;
+                    while (true) {
+                        end_t leaving = Partner[arrived];
+                        expected      = unlabeled;
+                        if (!label_of(leaving >> 1).compare_exchange_strong(expected, walk)) {
+                            if (expected != walk) {
+                                links[thread_index].emplace_back(walk, expected);
+                            }
+                            break;
+                        }
+                        arrived = leaving ^ 1;
+                    }
+                    if (if_directed) {
+                        break;
+                    }
+                }
+            }
+        });
+
+        // union walks into sub-trails
+        TrackedVector<std::uint32_t> parent(num_of_edges);
+        std::iota(parent.begin(), parent.end(), 0);
+        for (auto&& thread_links : links) {
+            for (auto&& [walk, another] : thread_links) {
+                size_t lhs = find_root(parent, walk);
+                size_t rhs = find_root(parent, another);
+                if (lhs != rhs) {
+                    parent[std::max(lhs, rhs)] = std::min(lhs, rhs);
+                }
+            }
+        }
+        for (size_t walk = 0; walk < num_of_edges; ++walk) {
+            parent[walk] = parent[parent[walk]]; // parent[walk] <= walk => fully compressed
+        }
+        TrailOf.resize(num_of_edges);
+        run_in_parallel([&](size_t thread_index) {
+            auto [begin, end] = return_chunk(num_of_edges, thread_index);
+            for (size_t edge = begin; edge < end; ++edge) {
+                TrailOf[edge] = parent[Label[edge]];
+            }
+        });
+    }
+
+    /// @brief 3). splice sub-trails through shared vertices
+    void splice_sub_trails() {
+        TrackedVector<std::uint32_t> parent(num_of_edges);
+        std::iota(parent.begin(), parent.end(), 0);
+        for (size_t vertex = 1; vertex <= num_of_nodes; ++vertex) {
+            size_t first = EndBegin[vertex];
+            size_t last  = EndBegin[vertex + 1];
+            if (first == last) {
+                continue;
+            }
+            // @e directed => only in_ends (odd, placed first) are swapped
+            end_t anchor = EndsAt[first];
+            for (size_t index = first + 1; index < last; ++index) {
+                end_t another = EndsAt[index];
+                if (if_directed && (another & 1) == 0) {
+                    break;
+                }
+                size_t lhs = find_root(parent, TrailOf[anchor >> 1]);
+                size_t rhs = find_root(parent, TrailOf[another >> 1]);
+                if (lhs == rhs) {
+                    continue;
+                }
+                end_t anchor_partner       = Partner[anchor];
+                end_t another_partner      = Partner[another];
+                Partner[anchor]            = another_partner;
+                Partner[another]           = anchor_partner;
+                Partner[another_partner]   = anchor;
+                Partner[anchor_partner]    = another;
+                parent[std::max(lhs, rhs)] = std::min(lhs, rhs);
+            }
+        }
+    }
+
+    /// @brief 4). emit the circle, by list ranking
+    void emit_circuit(std::uint32_t vertex) {
+        if (EndBegin[vertex] == EndBegin[vertex + 1]) {
+            Circuit.assign(1, vertex); // isolated
+            return;
+        }
+        Circuit.assign(num_of_edges + 1, vertex);
+
+        // arrive at `vertex` through its first end ( @e directed => an in_end)
+        end_t start_arrived = EndsAt[EndBegin[vertex]];
+
+        TrackedVector<std::uint8_t> if_splitter(num_of_edges, 0);
+        size_t                      num_of_splitters = std::min(num_of_edges, num_of_threads * 16);
+        for (size_t index = 0; index < num_of_splitters; ++index) {
+            if_splitter[num_of_edges * index / num_of_splitters] = 1;
+        }
+        if_splitter[start_arrived >> 1] = 1;
+
+        // @e undirected => the orientation of the circle is unknown yet,
+        // so both ends of each splitter start a segment (sorted, for the lookup below)
+        TrackedVector<end_t> seg_start;
+        for (size_t edge = 0; edge < num_of_edges; ++edge) {
+            if (if_splitter[edge]) {
+                if (!if_directed) {
+                    seg_start.push_back(2 * edge);
+                }
+                seg_start.push_back(2 * edge + 1);
+            }
+        }
+        // each segment is walked @b once , into its own buffer
+        TrackedVector<TrackedVector<std::uint32_t>> seg_vertices(seg_start.size());
+        TrackedVector<end_t>                        seg_stop(seg_start.size());
+        run_in_parallel([&](size_t thread_index) {
+            auto [begin, end] = return_chunk(seg_start.size(), thread_index);
+            for (size_t seg = begin; seg < end; ++seg) {
+                end_t arrived = seg_start[seg];
+                do {
+                    arrived = Partner[arrived] ^ 1;
+                    seg_vertices[seg].push_back(return_vertex_of(arrived));
+                } while (!if_splitter[arrived >> 1]);
+                seg_stop[seg] = arrived;
+            }
+        });
+
+        // chain the segments from `start_arrived`
+        TrackedVector<std::pair<size_t, size_t>> chain; // { seg, offset }
+        size_t                                   offset = 1;
+        end_t                                    curr   = start_arrived;
+        do {
+            size_t seg = std::lower_bound(seg_start.begin(), seg_start.end(), curr) - seg_start.begin();
+            chain.emplace_back(seg, offset);
+            offset += seg_vertices[seg].size();
+            curr = seg_stop[seg];
+        } while (curr != start_arrived);
+
+        run_in_parallel([&](size_t thread_index) {
+            auto [begin, end] = return_chunk(chain.size(), thread_index);
+            for (size_t index = begin; index < end; ++index) {
+                auto [seg, seg_offset] = chain[index];
+                std::copy(
+                    seg_vertices[seg].begin(),
+                    seg_vertices[seg].end(),
+                    Circuit.begin() + seg_offset
+                );
+            }
+        });
+    }
+
+public:
+    explicit ParallelHierholzer(size_t input_num_of_threads = std::thread::hardware_concurrency())
+        : num_of_threads(std::max<size_t>(input_num_of_threads, 1)) { }
+
+    void set_num_of_threads(size_t input_num_of_threads) {
+        num_of_threads = std::max<size_t>(input_num_of_threads, 1);
+    }
+    constexpr size_t return_num_of_threads() {
+        return num_of_threads;
+    }
+
+    /// @brief take the edges of a @b GraphView , the view itself is @p not_modified
+    template <GraphView G>
+    void load(G& graph) {
+        if_directed  = G::if_directed;
+        num_of_nodes = graph.return_num_of_nodes();
+        Tail.clear();
+        Head.clear();
+        for (size_t vertex = 1; vertex <= num_of_nodes; ++vertex) {
+            for (size_t col = graph.return_first_iterable(vertex);
+                 col != 0;
+                 col = graph.return_next_iterable(vertex, col)) {
+                if (!G::if_directed && col < vertex) {
+                    continue; // has been taken from the other side
+                }
+                size_t multiplicity = graph.return_multiplicity(vertex, col);
+                for (size_t i = 0; i < multiplicity; ++i) {
+                    Tail.push_back(vertex);
+                    Head.push_back(col);
+                }
+            }
+        }
+        num_of_edges = Tail.size();
+    }
+    /// @brief take an edge list directly, vertex @p start_from_`1`
+    void load_edges(
+        bool                           input_if_directed,
+        size_t                         input_num_of_nodes,
+        TrackedVector<std::uint32_t>&& tails,
+        TrackedVector<std::uint32_t>&& heads
+    ) {
+        if_directed  = input_if_directed;
+        num_of_nodes = input_num_of_nodes;
+        Tail         = std::move(tails);
+        Head         = std::move(heads);
+        num_of_edges = Tail.size();
+    }
+
+    /**
+     * @brief build the euler circle from `vertex`
+     * @attention the loaded graph @p must_have an euler circle (check it ahead)
+     * @return vertices of the circle ( @b first == @b last == `vertex` ),
+     *         it's an internal buffer, valid until next @p load / @p run
+     */
+    TrackedVector<std::uint32_t>& run(std::uint32_t vertex) {
+        if (num_of_edges == 0) {
+            Circuit.assign(1, vertex);
+            return Circuit;
+        }
+        TraceSpan span("hierholzer_parallel", "construction");
+        pair_ends();
+        label_sub_trails();
+        splice_sub_trails();
+        emit_circuit(vertex);
+        return Circuit;
+    }
+
+    constexpr size_t return_num_of_nodes() {
+        return num_of_nodes;
+    }
+    constexpr size_t return_num_of_edges() {
+        return num_of_edges;
+    }
+};
+
+} // namespace Tool
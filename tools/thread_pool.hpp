@@ -0,0 +1,178 @@
+/**
+ * @file thread_pool.hpp
+ * @author Eden (edwardwang33773@gmail.com)
+ * @brief A @b work_stealing thread pool
+ * @note
+        Each worker owns a @b deque of tasks =>
+            1. |-> tasks submitted @b by_a_worker go to its own deque (pushed / popped at the @b back ,
+                   so the newest, @b smallest subtask runs first, and stays @b cache_hot )
+            2. |-> tasks submitted from @b outside are dealt to the deques in turn
+            3. |-> an idle worker @b steals from the @b front of the others
+                   (the oldest, @b largest subtask => fewer steals)
+
+        @b return_worker_index() => index of the calling worker, in [0, num_of_threads) ,
+        so tasks could use @b per_worker scratch without any lock.
+
+        An exception thrown by a task is kept (the first one), and rethrown by @b wait() .
+ * @version 0.1
+ * @date 2022-10-27
+ *
+ * @copyright Copyright (c) 2022
+ *
+ */
+
+#pragma once
+
+#include "trace_events.hpp"
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace Tool {
+
+class ThreadPool {
+    struct Worker {
+        std::mutex                        Lock;
+        std::deque<std::function<void()>> Tasks;
+    };
+
+    std::vector<std::unique_ptr<Worker>> Workers;
+    std::vector<std::thread>             Threads;
+
+    std::atomic<size_t> NumOf_Queued  = 0; // in deques
+    std::atomic<size_t> NumOf_Pending = 0; // in deques or running
+    std::atomic<size_t> NextWorker    = 0; // for tasks from outside
+
+    std::mutex              Lock;
+    std::condition_variable WakeUp; // => workers
+    std::condition_variable Idle;   // => @b wait()
+    bool                    if_stop = false;
+    std::exception_ptr      Exception;
+
+    static inline thread_local const ThreadPool* CurrPool        = nullptr;
+    static inline thread_local size_t            CurrWorkerIndex = 0;
+
+    bool try_pop(size_t index, std::function<void()>& task) {
+        // own deque => back
+        {
+            std::lock_guard<std::mutex> guard(Workers[index]->Lock);
+            if (!Workers[index]->Tasks.empty()) {
+                task = std::move(Workers[index]->Tasks.back());
+                Workers[index]->Tasks.pop_back();
+                --NumOf_Queued;
+                return true;
+            }
+        }
+        // others => front
+        for (size_t offset = 1; offset < Workers.size(); ++offset) {
+            Worker&                     victim = *Workers[(index + offset) % Workers.size()];
+            std::lock_guard<std::mutex> guard(victim.Lock);
+            if (!victim.Tasks.empty()) {
+                task = std::move(victim.Tasks.front());
+                victim.Tasks.pop_front();
+                --NumOf_Queued;
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void work(size_t index) {
+        CurrPool        = this;
+        CurrWorkerIndex = index;
+        TraceRecorder::set_thread_name("worker " + std::to_string(index));
+        std::function<void()> task;
+        while (true) {
+            if (try_pop(index, task)) {
+                try {
+                    task();
+                } catch (...) {
+                    std::lock_guard<std::mutex> guard(Lock);
+                    if (!Exception) {
+                        Exception = std::current_exception();
+                    }
+                }
+                task = nullptr;
+                if (--NumOf_Pending == 0) {
+                    std::lock_guard<std::mutex> guard(Lock);
+                    Idle.notify_all();
+                }
+                continue;
+            }
+            std::unique_lock<std::mutex> lock(Lock);
+            WakeUp.wait(lock, [this] { return if_stop || NumOf_Queued > 0; });
+            if (if_stop && NumOf_Queued == 0) {
+                return;
+            }
+        }
+    }
+
+public:
+    explicit ThreadPool(size_t num_of_threads = std::thread::hardware_concurrency()) {
+        num_of_threads = std::max<size_t>(num_of_threads, 1);
+        for (size_t index = 0; index < num_of_threads; ++index) {
+            Workers.push_back(std::make_unique<Worker>());
+        }
+        for (size_t index = 0; index < num_of_threads; ++index) {
+            Threads.emplace_back(&ThreadPool::work, this, index);
+        }
+    }
+    ThreadPool(const ThreadPool&)            = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+    ~ThreadPool() {
+        {
+            std::lock_guard<std::mutex> guard(Lock);
+            if_stop = true;
+        }
+        WakeUp.notify_all();
+        for (auto&& thread : Threads) {
+            thread.join();
+        }
+    }
+
+    /// @brief could be called from @b anywhere , including a running task
+    void submit(std::function<void()> task) {
+        size_t index = CurrPool == this
+            ? CurrWorkerIndex
+            : NextWorker.fetch_add(1, std::memory_order_relaxed) % Workers.size();
+        ++NumOf_Pending;
+        {
+            std::lock_guard<std::mutex> guard(Lock); // no lost wake up
+            ++NumOf_Queued;
+        }
+        {
+            std::lock_guard<std::mutex> guard(Workers[index]->Lock);
+            Workers[index]->Tasks.push_back(std::move(task));
+        }
+        WakeUp.notify_one();
+    }
+
+    /// @brief block until @b all tasks (and the tasks they submitted) are done
+    /// @attention @p never_call it from a task
+    void wait() {
+        std::unique_lock<std::mutex> lock(Lock);
+        Idle.wait(lock, [this] { return NumOf_Pending == 0; });
+        if (Exception) {
+            std::rethrow_exception(std::exchange(Exception, nullptr));
+        }
+    }
+
+    size_t return_num_of_threads() const {
+        return Workers.size();
+    }
+    /// @brief index of the calling worker, @b num_of_threads if it's not a worker of this pool
+    size_t return_worker_index() const {
+        return CurrPool == this ? CurrWorkerIndex : Workers.size();
+    }
+};
+
+} // namespace Tool
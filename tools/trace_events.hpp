@@ -0,0 +1,241 @@
+/**
+ * @file trace_events.hpp
+ * @author Eden (edwardwang33773@gmail.com)
+ * @brief TraceSpan => @b where the time goes, as a @b timeline of phases ( @e Chrome_trace_event JSON)
+ * @note
+        @b TraceSpan is @b scoped => constructed at the begin of a phase, recorded at its end,
+        as one @b complete_event ( @p ph => "X" ) of the calling thread =>
+
+            {"name":"connectivity","cat":"graph","ph":"X","ts":12.345,"dur":6.789,"pid":1,"tid":2}
+
+        @b ts / @b dur are in @b microseconds, from @b TraceRecorder::start() .
+        Threads are numbered in the order they first record (main thread => mostly `1`),
+        @b set_thread_name gives them a name in the viewer ( @p ph => "M" ).
+
+        @b Recording is switched at @b runtime => when it's off, a span costs @b one relaxed load,
+        so spans are only put around @b phases (validation, degree checks, connectivity,
+        circle construction, formatting), @p never inside a traversal loop.
+
+        Each thread appends to its @b own buffer, all buffers are kept in a @b registry ,
+        so events of a thread which has exited are still written.
+
+        Usage =>
+            Tool::TraceRecorder::start();
+            ... // solve
+            Tool::TraceRecorder::stop();
+            Tool::TraceRecorder::write_json(file); // open it in https://ui.perfetto.dev
+
+        @attention @b name / @b category of a span are @p not_copied => pass @b string_literals
+ * @version 0.1
+ * @date 2022-10-28
+ *
+ * @copyright Copyright (c) 2022
+ *
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace Tool {
+
+class TraceRecorder {
+    using clock = std::chrono::steady_clock;
+
+    struct Event {
+        const char*   Name;
+        const char*   Category;
+        std::int64_t  Begin;    // ns from @b Origin
+        std::int64_t  Duration; // ns
+    };
+    struct ThreadBuffer {
+        std::mutex         Lock; // only contended while being written out
+        std::uint32_t      Tid = 0;
+        std::string        Name;
+        std::vector<Event> Events;
+    };
+    struct Registry {
+        std::mutex                                 Lock;
+        std::vector<std::shared_ptr<ThreadBuffer>> Buffers;
+        std::atomic<bool>                          if_recording = false;
+        std::atomic<std::int64_t>                  Origin       = 0; // ns of @b clock
+        std::uint32_t                              NextTid      = 1;
+    };
+    static Registry& return_registry() {
+        static Registry res;
+        return res;
+    }
+    /// @brief the buffer of the calling thread, registered on first use (kept after the thread exits)
+    static ThreadBuffer& return_local_buffer() {
+        thread_local std::shared_ptr<ThreadBuffer> res = [] {
+            Registry&                   registry = return_registry();
+            auto                        buffer   = std::make_shared<ThreadBuffer>();
+            std::lock_guard<std::mutex> guard(registry.Lock);
+            buffer->Tid = registry.NextTid++;
+            registry.Buffers.push_back(buffer);
+            return buffer;
+        }();
+        return *res;
+    }
+    static std::int64_t return_now() {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(
+            clock::now().time_since_epoch()
+        ).count();
+    }
+
+    static void append_escaped(std::string& output, std::string_view text) {
+        for (char curr : text) {
+            if (curr == '"' || curr == '\\') {
+                output += '\\';
+                output += curr;
+            } else if (static_cast<unsigned char>(curr) < 0x20) {
+                char escaped[8];
+                std::snprintf(escaped, sizeof(escaped), "\\u%04x", static_cast<unsigned>(curr));
+                output += escaped;
+            } else {
+                output += curr;
+            }
+        }
+    }
+    /// @brief ns => "us.fraction" ( @b 3 digits, the precision of the viewer)
+    static void append_microseconds(std::string& output, std::int64_t nanoseconds) {
+        nanoseconds = std::max<std::int64_t>(nanoseconds, 0);
+        output += std::to_string(nanoseconds / 1000);
+        output += '.';
+        auto fraction = std::to_string(nanoseconds % 1000);
+        output.append(3 - fraction.size(), '0');
+        output += fraction;
+    }
+
+public:
+    TraceRecorder() = delete;
+
+    /// @brief drop all recorded events, and begin to record ( @b ts => `0` from now)
+    static void start() {
+        Registry&                   registry = return_registry();
+        std::lock_guard<std::mutex> guard(registry.Lock);
+        // buffers of exited threads are only held here => dropped
+        std::erase_if(registry.Buffers, [](auto& buffer) { return buffer.use_count() == 1; });
+        for (auto&& buffer : registry.Buffers) {
+            std::lock_guard<std::mutex> buffer_guard(buffer->Lock);
+            buffer->Events.clear();
+        }
+        registry.Origin.store(return_now(), std::memory_order_relaxed);
+        registry.if_recording.store(true, std::memory_order_release);
+    }
+    /// @brief spans which end later are @b not recorded
+    static void stop() {
+        return_registry().if_recording.store(false, std::memory_order_release);
+    }
+    static bool if_recording() {
+        return return_registry().if_recording.load(std::memory_order_relaxed);
+    }
+
+    /// @brief name of the calling thread in the viewer (e.g. "worker 3")
+    static void set_thread_name(std::string_view name) {
+        ThreadBuffer&               buffer = return_local_buffer();
+        std::lock_guard<std::mutex> guard(buffer.Lock);
+        buffer.Name = name;
+    }
+
+    /// @brief a @b complete_event of the calling thread, `begin` / `end` => ns of @b steady_clock
+    static void record(const char* name, const char* category, std::int64_t begin, std::int64_t end) {
+        ThreadBuffer&               buffer = return_local_buffer();
+        std::int64_t                origin = return_registry().Origin.load(std::memory_order_relaxed);
+        std::lock_guard<std::mutex> guard(buffer.Lock);
+        buffer.Events.push_back({ name, category, begin - origin, end - begin });
+    }
+
+    static size_t return_num_of_events() {
+        Registry&                   registry = return_registry();
+        std::lock_guard<std::mutex> guard(registry.Lock);
+        size_t                      res = 0;
+        for (auto&& buffer : registry.Buffers) {
+            std::lock_guard<std::mutex> buffer_guard(buffer->Lock);
+            res += buffer->Events.size();
+        }
+        return res;
+    }
+
+    /**
+     * @brief all recorded events, as a @e Chrome_trace_event JSON object
+     * @note written @b buffer by @b buffer , so a long trace is never held twice in memory
+     */
+    static void write_json(std::ostream& output) {
+        Registry&                   registry = return_registry();
+        std::lock_guard<std::mutex> guard(registry.Lock);
+
+        std::string text = "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n";
+        bool        if_first = true;
+        auto        begin_event = [&text, &if_first] {
+            if (!if_first) {
+                text += ",\n";
+            }
+            if_first = false;
+        };
+        for (auto&& buffer : registry.Buffers) {
+            std::lock_guard<std::mutex> buffer_guard(buffer->Lock);
+            std::string                 tid = std::to_string(buffer->Tid);
+            if (!buffer->Name.empty()) {
+                begin_event();
+                text += "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" + tid + ",\"args\":{\"name\":\"";
+                append_escaped(text, buffer->Name);
+                text += "\"}}";
+            }
+            for (auto&& event : buffer->Events) {
+                begin_event();
+                text += "{\"name\":\"";
+                append_escaped(text, event.Name);
+                text += "\",\"cat\":\"";
+                append_escaped(text, event.Category);
+                text += "\",\"ph\":\"X\",\"ts\":";
+                append_microseconds(text, event.Begin);
+                text += ",\"dur\":";
+                append_microseconds(text, event.Duration);
+                text += ",\"pid\":1,\"tid\":" + tid + "}";
+            }
+            output.write(text.data(), static_cast<std::streamsize>(text.size()));
+            text.clear();
+        }
+        text += "\n]}\n";
+        output.write(text.data(), static_cast<std::streamsize>(text.size()));
+        output.flush();
+    }
+
+    friend class TraceSpan;
+};
+
+/// @brief a @b scoped phase => recorded when it ends, only if recording was on when it began
+class TraceSpan {
+    const char*  Name;
+    const char*  Category;
+    std::int64_t Begin = -1; // -1 => not recording
+
+public:
+    explicit TraceSpan(const char* name, const char* category = "graph")
+        : Name(name)
+        , Category(category) {
+        if (TraceRecorder::if_recording()) {
+            Begin = TraceRecorder::return_now();
+        }
+    }
+    TraceSpan(const TraceSpan&)            = delete;
+    TraceSpan& operator=(const TraceSpan&) = delete;
+    ~TraceSpan() {
+        if (Begin >= 0 && TraceRecorder::if_recording()) {
+            TraceRecorder::record(Name, Category, Begin, TraceRecorder::return_now());
+        }
+    }
+};
+
+} // namespace Tool
@@ -1,9 +1,27 @@
 add_rules("mode.debug", "mode.release")
 
+-- `xmake f --counters=y` => hot-path counters, see `tools/hot_path_counters.hpp`
+option("counters")
+    set_default(false)
+    set_showmenu(true)
+    set_description("Count hot-path events (matrix allocations, connectivity checks, edges cut...)")
+    add_defines("DISCRETE_MATH_COUNTERS")
+option_end()
+
 target("DiscreteMath_Exp")
     set_kind("binary")
     add_files("src/*.cpp")
     set_languages("clatest", "gnuxxlatest")
+    add_options("counters")
+
+-- `xmake build euler_bench` , then `xmake run euler_bench [--quick] [--csv]`
+target("euler_bench")
+    set_kind("binary")
+    set_default(false)
+    add_files("bench/*.cpp")
+    set_languages("clatest", "gnuxxlatest")
+    set_optimize("fastest")
+    add_options("counters")
 
 --
 -- If you want to known more usage about xmake, please see https://xmake.io